@@ -76,3 +76,30 @@ macro (ARTS_TEST_CTLFILE_DEPENDS TESTNAME DEPENDNAME)
     )
 endmacro (ARTS_TEST_CTLFILE_DEPENDS)
 
+
+macro (ARTS_TEST_CTLFILE_REMOVE_FILES TESTNAME PATTERN)
+  set(REMOVE_FILES
+      "${CMAKE_CURRENT_BINARY_DIR}/${PATTERN};${ARTS_BINARY_DIR}/python/${PATTERN}")
+  add_test(
+    NAME arts.ctlfile.${TESTNAME}.setup
+    COMMAND ${CMAKE_COMMAND} "-DFILES=${REMOVE_FILES}"
+            -P ${ARTS_SOURCE_DIR}/cmake/scripts/remove_test_files.cmake
+    )
+  add_test(
+    NAME arts.ctlfile.${TESTNAME}.cleanup
+    COMMAND ${CMAKE_COMMAND} "-DFILES=${REMOVE_FILES}"
+            -P ${ARTS_SOURCE_DIR}/cmake/scripts/remove_test_files.cmake
+    )
+  set_tests_properties(
+    arts.ctlfile.${TESTNAME}.setup
+    PROPERTIES FIXTURES_SETUP ${TESTNAME}.files
+    )
+  set_tests_properties(
+    arts.ctlfile.${TESTNAME}.cleanup
+    PROPERTIES FIXTURES_CLEANUP ${TESTNAME}.files
+    )
+  set_tests_properties(
+    arts.ctlfile.${TESTNAME} python.arts.ctlfile.${TESTNAME}
+    PROPERTIES FIXTURES_REQUIRED ${TESTNAME}.files
+    )
+endmacro (ARTS_TEST_CTLFILE_REMOVE_FILES)
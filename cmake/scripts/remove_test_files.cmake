@@ -0,0 +1,10 @@
+# Removes the files that a test leaves in its working directory
+#
+# Usage: cmake -DFILES="<glob>[;<glob>...]" -P remove_test_files.cmake
+
+foreach (PATTERN ${FILES})
+  file (GLOB OLD_FILES ${PATTERN})
+  if (OLD_FILES)
+    file (REMOVE ${OLD_FILES})
+  endif ()
+endforeach ()
@@ -17,6 +17,10 @@ Attributes:
 
     arts_api(CDLL): The ctypes library handle holding the ARTS C API.
 
+The C API can be used from several Python threads, each with its own
+workspace. ctypes releases the GIL for the duration of every call into a
+CDLL, so agendas of different workspaces run in parallel.
+
 """
 
 import ctypes as c
@@ -419,14 +423,23 @@ arts_api.get_variable_value.restype  = VariableValueStruct
 arts_api.set_variable_value.argtypes = [c.c_void_p, c.c_long, c.c_long, VariableValueStruct]
 arts_api.set_variable_value.restype  =  c.c_char_p
 
+# Resize a tensor variable in a given workspace and return its memory in the form
+# of a VariableValueStruct.
+arts_api.resize_variable_value.argtypes = [c.c_void_p, c.c_long, c.c_long, VariableValueStruct]
+arts_api.resize_variable_value.restype  = VariableValueStruct
+
 # Adds a value of a given group to a given workspace.
 arts_api.add_variable.restype  = c.c_long
 arts_api.add_variable.argtypes = [c.c_void_p, c.c_long, c.c_char_p]
 
 # Remove given variable from workspace.
-arts_api.erase_variable.restype  = None
+arts_api.erase_variable.restype  = c.c_char_p
 arts_api.erase_variable.argtypes = [c.c_void_p, c.c_long, c.c_long]
 
+# Share a variable of one workspace with another.
+arts_api.share_variable.restype  = c.c_char_p
+arts_api.share_variable.argtypes = [c.c_void_p, c.c_void_p, c.c_long]
+
 # Methods
 #
 # Returns the number of (symbolic) workspace variable.
@@ -18,6 +18,7 @@ import io
 import os
 import sys
 import tempfile
+import threading
 
 class CoutCapture():
     """
@@ -46,20 +47,33 @@ class CoutCapture():
         self.silent = silent
 
     def __enter__(self):
+        global active_captures
         if cout_file:
-            cout_file.seek(0)
-            cout_file.truncate()
+            with cout_lock:
+                # Workspaces running on other threads write to the same
+                # file, only start afresh if none of them is.
+                if active_captures == 0:
+                    cout_file.seek(0)
+                    cout_file.truncate()
+                active_captures += 1
 
     def __exit__(self, type, value, traceback):
-        if cout_file and not self.silent:
-            #cout_file.flush()
-            cout_file.seek(0, io.SEEK_SET)
-            lines = [l.decode("UTF8") for l in cout_file.readlines()]
-            if lines:
+        global active_captures
+        if cout_file:
+            with cout_lock:
+                active_captures -= 1
+                #cout_file.flush()
+                cout_file.seek(0, io.SEEK_SET)
+                lines = [l.decode("UTF8") for l in cout_file.readlines()]
+                cout_file.seek(0)
+                cout_file.truncate()
+            if lines and not self.silent:
                 print("".join(["ARTS[{0}]: {1}".format(self.ws.ptr , l)
                                for l in lines]))
 
 cout_file = None
+cout_lock = threading.Lock()
+active_captures = 0
 try:
     sys.stdout.fileno()
 except:
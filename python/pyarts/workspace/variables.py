@@ -21,7 +21,7 @@ import scipy as sp
 import tempfile
 import weakref
 
-from pyarts.workspace.api import arts_api
+from pyarts.workspace.api import arts_api, VariableValueStruct
 from pyarts.workspace.agendas import Agenda
 from pyarts.xml.names import tensor_names
 
@@ -384,12 +384,66 @@ class WorkspaceVariable:
                                         "data" : (v.ptr, False),
                                         "version" : 3}
 
+    def resize(self, shape):
+        """ Resize variable in its workspace and return a view of its memory.
+
+        The returned numpy array does not own its data but points to the
+        memory of the variable in the ARTS workspace, so that it can be
+        filled in place without copying. Setting the variable to this array
+        afterwards does not copy either.
+
+        The view is only valid until the variable is resized again, either
+        through this method or by a workspace method that writes to it.
+
+        Args:
+            shape(tuple): The new shape of the variable.
+
+        Returns:
+            numpy.ndarray viewing the memory of the variable.
+
+        Raises:
+            Exception: If the variable is not a Vector, Matrix or Tensor3-7
+            or has no associated workspace.
+        """
+        if self.ws is None or not self.ndim:
+            raise Exception("Only Vector, Matrix and Tensor3-7 variables of a "
+                            "workspace can be resized.")
+        shape = tuple(shape)
+        if len(shape) != self.ndim:
+            raise ValueError("Shape {} does not match the dimension of {}."
+                             .format(shape, self.name))
+
+        s = VariableValueStruct.empty()
+        for i, n in enumerate(shape):
+            s.dimensions[i] = n
+        v = arts_api.resize_variable_value(self.ws.ptr, self.ws_id,
+                                           self.group_id, s)
+        if not v.initialized:
+            raise Exception("Could not resize {}: {}"
+                            .format(self.name, arts_api.get_error().decode()))
+        if not v.ptr:
+            return np.zeros(shape)
+
+        self.__array_interface__ = {"shape"  : shape,
+                                    "typestr" : "|f8",
+                                    "data" : (v.ptr, False),
+                                    "version" : 3}
+        return np.asarray(self)
+
     def erase(self):
         """
         Erase workspace variable from its associated workspace.
+
+        Raises:
+            Exception: If the variable is held by a workspace that is
+            executing, e.g. when erased from a callback of an agenda.
         """
         if self.ws:
-            arts_api.erase_variable(self.ws.ptr, self.ws_id, self.group_id)
+            err = arts_api.erase_variable(self.ws.ptr, self.ws_id,
+                                          self.group_id)
+            if not err is None:
+                raise Exception("Could not erase {}: {}"
+                                .format(self.name, err.decode()))
             self.ws = None
 
     def describe(self):
@@ -462,6 +462,38 @@ class Workspace:
                                 + str(type(value)) + " is neither supported by "
                                 + "the C API nor arts XML IO.")
 
+    def share(self, wsv, other):
+        """
+        Make a variable of another workspace available in this one without
+        copying it.
+
+        This is meant for large read-only data, e.g. an absorption lookup
+        table that several workspaces use when they are run in parallel from
+        different threads. Setting the variable in this workspace fails until
+        it is set to None, which drops the shared reference. `other` must be
+        kept alive as long as the variable is used.
+
+        Args:
+            wsv: The :class:`WorkspaceVariable` or the name of the variable
+                to share.
+            other: The :class:`Workspace` holding the variable.
+        """
+        if isinstance(wsv, str):
+            wsv = getattr(other, wsv)
+
+        err = arts_api.share_variable(self.ptr, other.ptr, wsv.ws_id)
+        if not err is None:
+            msg = ("The following error occurred when trying to share the"
+                   " WSV {}: {}".format(wsv.name, err.decode()))
+            raise Exception(msg)
+
+        if wsv.name in other._vars:
+            self._vars[wsv.name] = WorkspaceVariable(wsv.ws_id,
+                                                     wsv.name,
+                                                     wsv.group,
+                                                     wsv.description,
+                                                     self)
+
     def __dir__(self):
         return {**self._vars, **workspace_variables, **self.__dict__}
 
@@ -1,5 +1,6 @@
 # -*- encoding: utf-8 -*-
 import os
+import threading
 
 import numpy as np
 import pytest
@@ -7,6 +8,7 @@ import scipy as sp
 
 import pyarts
 from pyarts.workspace import Workspace, arts_agenda
+from pyarts.workspace.agendas import Agenda
 from pyarts.workspace.variables import WorkspaceVariable
 
 def agenda(ws):
@@ -110,3 +112,110 @@ class TestWorkspace:
 
         self.ws.f_grid = np.ascontiguousarray(x[::2])
         assert np.array_equal(self.ws.f_grid.value, x[::2])
+
+    def test_resize_in_place(self):
+        t = self.ws.t_field.resize((21, 1, 1))
+        t[:, 0, 0] = np.linspace(300, 200, 21)
+        assert np.array_equal(self.ws.t_field.value[:, 0, 0], t[:, 0, 0])
+
+        # Setting the variable from its own memory must keep the values
+        self.ws.t_field = t
+        assert np.array_equal(self.ws.t_field.value[:, 0, 0],
+                              np.linspace(300, 200, 21))
+
+        # Setting from a part of its own memory with another shape
+        self.ws.t_field = np.ascontiguousarray(t[:10])
+        assert self.ws.t_field.value.shape == (10, 1, 1)
+        assert np.array_equal(self.ws.t_field.value[:, 0, 0],
+                              np.linspace(300, 200, 21)[:10])
+
+        # Invalid shapes are rejected and keep the variable as it was
+        with pytest.raises(Exception):
+            self.ws.t_field.resize((-1, 1, 1))
+        with pytest.raises(Exception):
+            self.ws.t_field.resize((2 ** 62, 2 ** 62, 1))
+        assert self.ws.t_field.value.shape == (10, 1, 1)
+
+    def test_share(self):
+        ws = Workspace()
+        ws.share("p_grid", self.ws)
+        assert np.array_equal(ws.p_grid.value, self.ws.p_grid.value)
+
+        v = self.ws.add_variable(np.ones(3))
+        ws.share(v, self.ws)
+        assert np.array_equal(getattr(ws, v.name).value, np.ones(3))
+
+    def test_share_reassign(self):
+        ws = Workspace()
+        ws.share("p_grid", self.ws)
+        p_grid = self.ws.p_grid.value.copy()
+
+        # The shared value cannot be overwritten through ws
+        with pytest.raises(Exception):
+            ws.p_grid = np.ones(3)
+        with pytest.raises(Exception):
+            ws.p_grid.resize((3,))
+        with pytest.raises(Exception):
+            ws.VectorScale(ws.p_grid, ws.p_grid, 2.0)
+        assert np.array_equal(self.ws.p_grid.value, p_grid)
+
+        # Re-initializing drops the reference without freeing the value
+        ws.p_grid = None
+        ws.p_grid = np.ones(3)
+        assert np.array_equal(ws.p_grid.value, np.ones(3))
+        assert np.array_equal(self.ws.p_grid.value, p_grid)
+
+        del ws
+        assert np.array_equal(self.ws.p_grid.value, p_grid)
+
+    def test_threads(self):
+        def run(i):
+            ws = Workspace()
+            v = ws.add_variable(i * np.ones(10))
+            ws.VectorScale(v, v, 2.0)
+            results[i] = v.value.copy()
+            v.erase()
+
+        results = [None] * 4
+        threads = [threading.Thread(target=run, args=(i,)) for i in range(4)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+
+        for i, r in enumerate(results):
+            assert np.array_equal(r, 2.0 * i * np.ones(10))
+
+    def test_threads_overlapping_execution(self):
+        in_callback = threading.Event()
+        release = threading.Event()
+
+        def wait(ptr):
+            in_callback.set()
+            release.wait()
+
+        ws = Workspace()
+        v = ws.add_variable(np.ones(10))
+        agenda = Agenda.create("wait")
+        agenda.add_callback(wait)
+        thread = threading.Thread(target=agenda.execute, args=(ws,))
+        thread.start()
+        assert in_callback.wait(60)
+
+        try:
+            # Other workspaces can be used while ws waits in its callback
+            other = Workspace()
+            w = other.add_variable(np.ones(10))
+            other.VectorScale(w, w, 2.0)
+            assert np.array_equal(w.value, 2.0 * np.ones(10))
+            w.erase()
+
+            # but the variables that ws holds cannot be erased
+            with pytest.raises(Exception):
+                v.erase()
+        finally:
+            release.set()
+            thread.join()
+
+        assert np.array_equal(v.value, np.ones(10))
+        v.erase()
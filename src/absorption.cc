@@ -630,7 +630,9 @@ void xsec_species(Matrix& xsec,
                   const AbsorptionLines& band,
                   const Numeric& isot_ratio,
                   const SpeciesAuxData::AuxType& partfun_type,
-                  const ArrayOfGriddedField1& partfun_data) {
+                  const ArrayOfGriddedField1& partfun_data,
+                  const FaddeevaBlock::Accuracy faddeeva_accuracy,
+                  const Numeric line_window_threshold) {
   // Size of problem
   const Index np = abs_p.nelem();      // number of pressure levels
   const Index nf = f_grid.nelem();     // number of Dirac frequencies
@@ -648,6 +650,24 @@ void xsec_species(Matrix& xsec,
   // Test if the size of the problem is 0
   if (not np or not nf or not nl) return;
   
+  // Lines that can contribute to this frequency grid
+  const ArrayOfIndex active_lines = band.LinesInFrequencyRange(min(f_grid), max(f_grid));
+  if (not active_lines.nelem()) return;
+  
+  const auto hotview = band.HotView();
+  
+  // A single level cannot be parallelized over levels, so the lines are split
+  // into one chunk per thread instead.  The chunks are summed in order after
+  const Index nchunks = (np == 1 and not arts_omp_in_parallel()) ?
+    std::min(Index(arts_omp_get_max_threads()), active_lines.nelem()) : 1;
+  ArrayOfArrayOfIndex chunks(nchunks);
+  for (Index ic = 0; ic < nchunks; ic++) {
+    const Index first = (ic * active_lines.nelem()) / nchunks;
+    const Index last = ((ic + 1) * active_lines.nelem()) / nchunks;
+    chunks[ic].assign(active_lines.begin() + first, active_lines.begin() + last);
+  }
+  std::vector<Linefunctions::InternalData> chunk_sums(nchunks > 1 ? nchunks : 0, sum);
+  
   // Constant for all lines
   const Numeric QT0 = single_partition_function(band.T0(), partfun_type, partfun_data);
   const Numeric dT = temperature_perturbation(jacobian_quantities);
@@ -679,24 +699,82 @@ void xsec_species(Matrix& xsec,
       const Vector line_shape_vmr =
           band.BroadeningSpeciesVMR(abs_vmrs(joker, ip), abs_species);
 
-      Linefunctions::set_cross_section_of_band(scratch,
-                                               sum,
-                                               f_grid,
-                                               band,
-                                               jacobian_quantities,
-                                               jacobian_propmat_positions,
-                                               line_shape_vmr,
-                                               abs_nlte[ip],
-                                               pressure,
-                                               temperature,
-                                               isot_ratio,
-                                               0,
-                                               DC,
-                                               dDCdT,
-                                               QT,
-                                               dQTdT,
-                                               QT0,
-                                               false);
+      if (nchunks == 1) {
+        Linefunctions::set_cross_section_of_band(scratch,
+                                                 sum,
+                                                 f_grid,
+                                                 band,
+                                                 *hotview,
+                                                 chunks[0],
+                                                 jacobian_quantities,
+                                                 jacobian_propmat_positions,
+                                                 line_shape_vmr,
+                                                 abs_nlte[ip],
+                                                 pressure,
+                                                 temperature,
+                                                 isot_ratio,
+                                                 0,
+                                                 DC,
+                                                 dDCdT,
+                                                 QT,
+                                                 dQTdT,
+                                                 QT0,
+                                                 false,
+                                                 false,
+                                                 Zeeman::Polarization::Pi,
+                                                 faddeeva_accuracy,
+                                                 line_window_threshold);
+      } else {
+        bool chunk_abort = false;
+        String chunk_msg;
+        
+#pragma omp parallel for firstprivate(scratch)
+        for (Index ic = 0; ic < nchunks; ic++) {
+          if (chunk_abort) continue;
+          try {
+            Linefunctions::set_cross_section_of_band(scratch,
+                                                     chunk_sums[ic],
+                                                     f_grid,
+                                                     band,
+                                                     *hotview,
+                                                     chunks[ic],
+                                                     jacobian_quantities,
+                                                     jacobian_propmat_positions,
+                                                     line_shape_vmr,
+                                                     abs_nlte[ip],
+                                                     pressure,
+                                                     temperature,
+                                                     isot_ratio,
+                                                     0,
+                                                     DC,
+                                                     dDCdT,
+                                                     QT,
+                                                     dQTdT,
+                                                     QT0,
+                                                     false,
+                                                     false,
+                                                     Zeeman::Polarization::Pi,
+                                                     faddeeva_accuracy,
+                                                     line_window_threshold);
+          } catch (const std::runtime_error& e) {
+#pragma omp critical(xsec_species_line_chunks)
+            {
+              chunk_abort = true;
+              chunk_msg = e.what();
+            }
+          }
+        }
+        if (chunk_abort) throw std::runtime_error(chunk_msg);
+        
+        // Deterministic reduction in the order of the lines
+        sum = chunk_sums[0];
+        for (Index ic = 1; ic < nchunks; ic++) {
+          sum.F.noalias() += chunk_sums[ic].F;
+          sum.N.noalias() += chunk_sums[ic].N;
+          sum.dF.noalias() += chunk_sums[ic].dF;
+          sum.dN.noalias() += chunk_sums[ic].dN;
+        }
+      }
 
       // absorption cross-section
       MapToEigen(xsec).col(ip).noalias() += sum.F.real();
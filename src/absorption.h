@@ -39,6 +39,7 @@
 #include "messages.h"
 #include "mystring.h"
 #include "absorptionlines.h"
+#include "faddeeva_block.h"
 
 /** Contains the lookup data for one isotopologue.
     \author Stefan Buehler */
@@ -378,6 +379,10 @@ void set_vmr_from_first_species(Vector& vmr,
                                 const Matrix& abs_vmrs);
 
 /** Cross-section algorithm
+ * 
+ *  Levels are computed in parallel.  A single level outside of a parallel
+ *  region is instead split into chunks of lines, one per thread, that are
+ *  summed in line order
  * 
  *  @param[in,out] xsec Cross section of one tag group. This is now the true attenuation cross section in units of m^2.
  *  @param[in,out] sourceCross section of one tag group. This is now the true source cross section in units of m^2.
@@ -397,6 +402,8 @@ void set_vmr_from_first_species(Vector& vmr,
  *  @param[in] isot_ratio Isotopologue ratio of this species
  *  @param[in] partfun_type Partition function type for this species
  *  @param[in] partfun_data Partition function model data for this species
+ *  @param[in] faddeeva_accuracy Accuracy tier of the Faddeeva function
+ *  @param[in] line_window_threshold Relative threshold of the adaptive line windows, 0 for none
  * 
  *  @author Richard Larsson
  *  @date   2019-10-10
@@ -418,7 +425,10 @@ void xsec_species(Matrix& xsec,
                   const AbsorptionLines& band,
                   const Numeric& isot_ratio,
                   const SpeciesAuxData::AuxType& partfun_type,
-                  const ArrayOfGriddedField1& partfun_data);
+                  const ArrayOfGriddedField1& partfun_data,
+                  const FaddeevaBlock::Accuracy faddeeva_accuracy =
+                      FaddeevaBlock::Accuracy::Exact,
+                  const Numeric line_window_threshold = 0);
 
 /** Returns the species data
  * 
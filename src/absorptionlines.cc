@@ -31,6 +31,8 @@
 
 #include "absorptionlines.h"
 
+#include <algorithm>
+#include <numeric>
 #include "absorption.h"
 #include "constants.h"
 #include "file.h"
@@ -2676,6 +2678,7 @@ bool Absorption::SingleLine::SameQuantumNumbers(const Absorption::SingleLine& sl
 
 void Absorption::Lines::RemoveLine(Index i) noexcept
 {
+  LinesChanged();
   mlines.erase(mlines.begin() + i);
 }
 
@@ -2698,6 +2701,7 @@ Absorption::Lines Absorption::createEmptyCopy(const Absorption::Lines& al) noexc
 
 Absorption::SingleLine& Absorption::Lines::Line(Index i) noexcept
 {
+  LinesChanged();
   return mlines[i];
 }
 
@@ -2709,9 +2713,121 @@ const Absorption::SingleLine& Absorption::Lines::Line(Index i) const noexcept
 
 void Absorption::Lines::ReverseLines() noexcept
 {
+  LinesChanged();
   std::reverse(mlines.begin(), mlines.end());
 }
 
+ArrayOfIndex Absorption::Lines::LinesInFrequencyRange(Numeric fmin, Numeric fmax) const
+{
+  ArrayOfIndex out;
+  out.reserve(NumLines());
+  
+  switch (mcutoff) {
+    case CutoffType::None:
+      for (Index i=0; i<NumLines(); i++) out.push_back(i);
+      break;
+    case CutoffType::BandFixedFrequency: {
+      // The band is either fully in or fully out.  An empty cutoff range means no cutoff
+      const Numeric fcut_upp = CutoffFreq(0);
+      const Numeric fcut_low = CutoffFreqMinus(0, F_mean());
+      if (fcut_upp <= fcut_low or (fcut_upp >= fmin and fcut_low <= fmax))
+        for (Index i=0; i<NumLines(); i++) out.push_back(i);
+    } break;
+    case CutoffType::LineByLineOffset: {
+      // An empty cutoff range means no cutoff
+      if (mcutofffreq <= 0) {
+        for (Index i=0; i<NumLines(); i++) out.push_back(i);
+        break;
+      }
+      
+      // Lines are kept if their cutoff range overlaps.  The cutoff ranges
+      // are in the order of F0, so the kept lines are contiguous in it
+      const auto order = mfrequencyorder.get([this]() {
+        ArrayOfIndex x(NumLines());
+        std::iota(x.begin(), x.end(), 0);
+        std::stable_sort(x.begin(), x.end(), [this](Index a, Index b) {return F0(a) < F0(b);});
+        return x;
+      });
+      const auto first = std::partition_point(order->cbegin(), order->cend(),
+                                              [&](Index i) {return CutoffFreq(i) < fmin;});
+      const auto last = std::partition_point(first, order->cend(),
+                                             [&](Index i) {return CutoffFreqMinus(i, 0) <= fmax;});
+      out.assign(first, last);
+      std::sort(out.begin(), out.end());
+    } break;
+  }
+  
+  return out;
+}
+
+std::shared_ptr<const Absorption::LinesHotView> Absorption::Lines::HotView() const
+{
+  return mhotview.get([this]() {return LinesHotView(*this);});
+}
+
+Absorption::LinesHotView::LinesHotView(const Lines& band) :
+  mF0(band.NumLines()), mnspecies(band.NumBroadeners()),
+  mT0(band.T0()), mlinemixinglimit(band.LinemixingLimit()),
+  mcoefs(LineShape::nVars * mnspecies * band.NumLines())
+{
+  const Index nl = band.NumLines();
+  for (Index il=0; il<nl; il++) {
+    mF0[il] = band.F0(il);
+    
+    const auto& ssms = band.Line(il).LineShape().Data();
+    if (Index(ssms.size()) not_eq mnspecies) {
+      std::ostringstream os;
+      os << "Line " << il << " has " << ssms.size()
+         << " line shape species but the band has " << mnspecies << " broadening species";
+      throw std::runtime_error(os.str());
+    }
+    for (Index is=0; is<mnspecies; is++)
+      for (Index iv=0; iv<LineShape::nVars; iv++)
+        mcoefs[(iv*mnspecies + is)*nl + il] = ssms[is].Data()[iv];
+  }
+}
+
+void Absorption::LinesHotView::ShapeParameters(std::vector<LineShape::Output>& X,
+                                               Numeric T,
+                                               Numeric P,
+                                               const Vector& vmrs,
+                                               const ArrayOfIndex& lines) const
+{
+  const Index nv = NumLines();
+  const Index nl = lines.nelem();
+  const bool do_linemixing = mlinemixinglimit < 0 ? true : mlinemixinglimit > P;
+  
+  X.resize(nl);
+  
+  // Each variable is summed over the broadening species in the same order as LineShape::Model
+  auto set = [&](Numeric LineShape::Output::*x, LineShape::Variable var, Numeric scale) {
+    for (Index il=0; il<nl; il++) X[il].*x = 0;
+    
+    for (Index is=0; is<mnspecies; is++) {
+      const LineShape::ModelParameters* coefs = mcoefs.data() + (Index(var)*mnspecies + is)*nv;
+      const Numeric vmr = vmrs[is];
+      for (Index il=0; il<nl; il++)
+        X[il].*x += vmr * LineShape::compute_model(coefs[lines[il]], T, mT0);
+    }
+    
+    for (Index il=0; il<nl; il++) X[il].*x *= scale;
+  };
+  
+  set(&LineShape::Output::G0, LineShape::Variable::G0, P);
+  set(&LineShape::Output::D0, LineShape::Variable::D0, P);
+  set(&LineShape::Output::G2, LineShape::Variable::G2, P);
+  set(&LineShape::Output::D2, LineShape::Variable::D2, P);
+  set(&LineShape::Output::FVC, LineShape::Variable::FVC, P);
+  set(&LineShape::Output::ETA, LineShape::Variable::ETA, 1);
+  if (do_linemixing) {
+    set(&LineShape::Output::Y, LineShape::Variable::Y, P);
+    set(&LineShape::Output::G, LineShape::Variable::G, P * P);
+    set(&LineShape::Output::DV, LineShape::Variable::DV, P * P);
+  } else {
+    for (Index il=0; il<nl; il++) X[il].Y = X[il].G = X[il].DV = 0;
+  }
+}
+
 Numeric Absorption::Lines::SpeciesMass() const noexcept
 {
   return global_data::species_data[Species()].Isotopologue()[Isotopologue()].Mass();
@@ -32,6 +32,7 @@
 #ifndef absorptionlines_h
 #define absorptionlines_h
 
+#include <memory>
 #include <vector>
 #include "bifstream.h"
 #include "bofstream.h"
@@ -544,6 +545,51 @@ struct SingleLineExternal {
   SingleLine line;
 };
 
+/** Data derived from a band, built on first use
+ * 
+ * The data is kept until reset() is called by the band when it changes.
+ * Copies of the band share the data.  get() may be called from several
+ * threads at the same time; they may then each build the data, and each
+ * gets complete data
+ */
+template <typename T>
+class LinesCache {
+  /** The data, or nothing if not built */
+  mutable std::shared_ptr<const T> mdata;
+  
+public:
+  LinesCache() = default;
+  
+  LinesCache(const LinesCache& x) noexcept : mdata(std::atomic_load(&x.mdata)) {}
+  
+  LinesCache& operator=(const LinesCache& x) noexcept {
+    std::atomic_store(&mdata, std::atomic_load(&x.mdata));
+    return *this;
+  }
+  
+  /** Returns the data, building it first if required
+   * 
+   * @param[in] build Function returning the data
+   * @return The data
+   */
+  template <typename Build>
+  std::shared_ptr<const T> get(Build&& build) const {
+    auto data = std::atomic_load(&mdata);
+    if (not data) {
+      data = std::make_shared<const T>(build());
+      std::atomic_store(&mdata, data);
+    }
+    return data;
+  }
+  
+  /** Drops the data */
+  void reset() noexcept {
+    std::atomic_store(&mdata, std::shared_ptr<const T>());
+  }
+};  // LinesCache
+
+class LinesHotView;
+
 class Lines {
 private:
   /** Does the line broadening have self broadening */
@@ -588,6 +634,22 @@ private:
   /** A list of individual lines */
   std::vector<SingleLine> mlines;
   
+  /** Indices of the lines sorted by F0 */
+  LinesCache<ArrayOfIndex> mfrequencyorder;
+  
+  /** Contiguous copy of the lines for the line-by-line loop */
+  LinesCache<LinesHotView> mhotview;
+  
+  /** Drops the data derived from the lines
+   * 
+   * Must be called by every function that can change the lines, the
+   * reference temperature, the line mixing limit or the broadening species
+   */
+  void LinesChanged() noexcept {
+    mfrequencyorder.reset();
+    mhotview.reset();
+  }
+  
 public:
   /** Default initialization
    * 
@@ -706,6 +768,7 @@ public:
        sl.LineShapeElems() not_eq mlines[0].LineShapeElems())
       throw std::runtime_error("Error calling appending function, bad size of broadening species");
     
+    LinesChanged();
     mlines.push_back(std::move(sl));
   }
   
@@ -730,6 +793,7 @@ public:
        sl.LineShapeElems() not_eq mlines[0].LineShapeElems())
       throw std::runtime_error("Error calling appending function, bad size of broadening species");
     
+    LinesChanged();
     mlines.push_back(sl);
   }
   
@@ -811,12 +875,14 @@ public:
   
   /** Sort inner line list by frequency */
   void sort_by_frequency() {
+    LinesChanged();
     std::sort(mlines.begin(), mlines.end(),
               [](const SingleLine& a, const SingleLine& b){return a.F0() < b.F0();});
   }
   
   /** Sort inner line list by Einstein coefficient */
   void sort_by_einstein() {
+    LinesChanged();
     std::sort(mlines.begin(), mlines.end(),
               [](const SingleLine& a, const SingleLine& b){return a.A() < b.A();});
   }
@@ -855,7 +921,7 @@ public:
   const std::vector<SingleLine>& AllLines() const noexcept {return mlines;}
   
   /** Lines */
-  std::vector<SingleLine>& AllLines() noexcept {return mlines;}
+  std::vector<SingleLine>& AllLines() noexcept {LinesChanged(); return mlines;}
   
   /** Number of broadening species */
   Index NumBroadeners() const noexcept {return Index(mbroadeningspecies.nelem());}
@@ -974,7 +1040,7 @@ public:
    * @param[in] k Line number (less than NumLines())
    * @return Central frequency
    */
-  Numeric& F0(size_t k) noexcept {return mlines[k].F0();}
+  Numeric& F0(size_t k) noexcept {LinesChanged(); return mlines[k].F0();}
   
   /** Mean frequency by weight of line strengt
    * 
@@ -1307,6 +1373,35 @@ public:
     std::terminate();
   }
   
+  /** Returns the lines that can contribute inside a frequency range
+   * 
+   * A line is only left out if the cutoff of the band keeps all of its
+   * absorption outside of [fmin, fmax].  Bands whose cutoff covers any part
+   * of the range return all lines.  Lines with a cutoff for each line are
+   * found by a binary search in the lines sorted by F0.  The indices are in
+   * the order of the band so that the summing order of the lines is the
+   * same as when all lines are visited
+   * 
+   * Bands without cutoff return all lines.  The wings of every line then
+   * reach every frequency, and the adaptive line windows that bound them
+   * depend on the broadening at each pressure level, so they are applied
+   * for each line and level in Linefunctions::set_cross_section_of_band
+   * 
+   * @param[in] fmin The lowest frequency of interest
+   * @param[in] fmax The highest frequency of interest
+   * @returns Indices of the lines that can contribute
+   */
+  ArrayOfIndex LinesInFrequencyRange(Numeric fmin, Numeric fmax) const;
+  
+  /** Returns the hot view of all lines of the band
+   * 
+   * The view is built on the first call after the band has been changed
+   * and is shared by all callers until the band is changed again
+   * 
+   * @return The view, see LinesHotView
+   */
+  std::shared_ptr<const LinesHotView> HotView() const;
+  
   /** Returns reference temperature */
   Numeric T0() const noexcept {
     return mT0;
@@ -1314,6 +1409,7 @@ public:
   
   /** Sets reference temperature */
   void T0(Numeric x) noexcept {
+    LinesChanged();
     mT0 = x;
   }
   
@@ -1334,6 +1430,7 @@ public:
   
   /** Sets line mixing limit */
   void LinemixingLimit(Numeric x) noexcept {
+    LinesChanged();
     mlinemixinglimit = x;
   }
   
@@ -1354,6 +1451,7 @@ public:
   
   /** Returns the broadening species */
   ArrayOfSpeciesTag& BroadeningSpecies() noexcept {
+    LinesChanged();
     return mbroadeningspecies;
   }
   
@@ -1436,6 +1534,7 @@ public:
   
   /** Binary read for Lines */
   bifstream& read(bifstream& is) {
+    LinesChanged();
     for (auto& line: mlines)
       line.read(is);
     return is;
@@ -1454,6 +1553,61 @@ public:
 std::ostream& operator<<(std::ostream&, const Lines&);
 std::istream& operator>>(std::istream&, Lines&);
 
+/** Contiguous view of the lines of a band for the line-by-line loop
+ * 
+ * Lines keeps one object per line and one line shape model object per line
+ * and broadening species.  This view copies the line shape coefficients of
+ * all lines into one array per variable and broadening species, so that the
+ * shape parameters of the lines at a pressure level are computed in tight
+ * passes over contiguous memory rather than line by line
+ * 
+ * The view is a copy.  Use Lines::HotView(), which keeps it until the band
+ * is changed
+ */
+class LinesHotView {
+  /** Line center frequencies */
+  std::vector<Numeric> mF0;
+  
+  /** Number of broadening species */
+  Index mnspecies;
+  
+  /** Reference temperature of the band */
+  Numeric mT0;
+  
+  /** Line mixing pressure limit of the band */
+  Numeric mlinemixinglimit;
+  
+  /** Line shape coefficients, [(variable*mnspecies + species)*nlines + line] */
+  std::vector<LineShape::ModelParameters> mcoefs;
+  
+public:
+  /** Copies the data of all lines
+   * 
+   * @param[in] band The absorption band
+   */
+  explicit LinesHotView(const Lines& band);
+  
+  /** Number of lines in the view */
+  Index NumLines() const noexcept {return Index(mF0.size());}
+  
+  /** Line center frequency of line k of the band */
+  Numeric F0(Index k) const noexcept {return mF0[k];}
+  
+  /** Line shape parameters of selected lines
+   * 
+   * Gives the same results as Lines::ShapeParameters for each line
+   * 
+   * @param[out] X Line shape parameters, resized to lines.nelem()
+   * @param[in] T Atmospheric temperature
+   * @param[in] P Atmospheric pressure
+   * @param[in] vmrs Line broadener's volume mixing ratio
+   * @param[in] lines Indices of the lines in the band, as per Lines::LinesInFrequencyRange()
+   */
+  void ShapeParameters(std::vector<LineShape::Output>& X, Numeric T,
+                       Numeric P, const Vector& vmrs,
+                       const ArrayOfIndex& lines) const;
+};  // LinesHotView
+
 /** Read from ARTSCAT-3
  * 
  * @param[in] is Input stream
@@ -30,6 +30,7 @@
 #include <ostream>
 
 #include "agenda_class.h"
+#include "agenda_profiler.h"
 #include "agenda_record.h"  // only for test functions
 #include "arts.h"
 #include "arts_omp.h"
@@ -39,6 +40,9 @@
 #include "methods.h"
 #include "workspace_ng.h"
 
+// The array holding the pointers to the getaway functions:
+extern void (*getaways[])(Workspace&, const MRecord&);
+
 //! Appends methods to an agenda
 /*!
   This function appends a workspace method to the agenda. It currently only
@@ -70,6 +74,7 @@ void Agenda::append(const String& methodname, const TokVal& keywordvalue) {
 
   mml.push_back(MRecord(id, output, input, keywordvalue, Agenda()));
   mchecked = false;
+  mplan.resize(0);
 }
 
 //! Checks consistency of an agenda.
@@ -93,6 +98,7 @@ void Agenda::check(Workspace& ws, const Verbosity& verbosity) {
   // until it is copied to a predefined agenda.
   if (mi == AgendaMap.end()) {
     mchecked = false;
+    mplan.resize(0);
     return;
   }
 
@@ -137,6 +143,50 @@ void Agenda::check(Workspace& ws, const Verbosity& verbosity) {
   set_outputs_to_push_and_dup(verbosity);
 
   mchecked = true;
+
+  compile();
+}
+
+//! Build the execution plan of an agenda.
+/*!
+  Resolves everything that execute needs per method and that does not
+  depend on the workspace: the getaway function and the list of WSVs that
+  must be initialized before the method is called. It also finds out if
+  the agenda can run on the verbosity of its caller.
+
+  This is called by check and set_main_agenda, so that a checked agenda
+  always has a plan.
+*/
+void Agenda::compile() {
+  using global_data::md_data;
+
+  const Index wsv_id_verbosity = get_wsv_id("verbosity");
+
+  mplan.resize(mml.nelem());
+  mdup_verbosity = main_agenda;
+  for (Index i = 0; i < mml.nelem(); ++i) {
+    const MRecord& mrr = mml[i];
+    const MdRecord& mdd = md_data[mrr.Id()];
+    MethodPlan& plan = mplan[i];
+
+    plan.getaway = getaways[mrr.Id()];
+
+    // The last input of a Set method is its value, not a WSV to check
+    const ArrayOfIndex& vin = mrr.In();
+    const Index nin =
+        mdd.SetMethod() ? std::max(vin.nelem() - 1, Index(0)) : vin.nelem();
+    plan.required.resize(0);
+    plan.required.reserve(nin + mdd.InOut().nelem());
+    for (Index s = 0; s < nin; ++s) plan.required.push_back(vin[s]);
+
+    // Output variables which are also used as input
+    for (Index s = 0; s < mdd.InOut().nelem(); ++s)
+      plan.required.push_back(mrr.Out()[mdd.InOut()[s]]);
+
+    if (std::find(mrr.Out().begin(), mrr.Out().end(), wsv_id_verbosity) !=
+        mrr.Out().end())
+      mdup_verbosity = true;
+  }
 }
 
 //! Execute an agenda.
@@ -173,22 +223,32 @@ void Agenda::execute(Workspace& ws) const {
   // The method description lookup table:
   using global_data::md_data;
 
-  // The array holding the pointers to the getaway functions:
-  extern void (*getaways[])(Workspace&, const MRecord&);
+  if (mplan.nelem() != mml.nelem()) {
+    ostringstream os;
+    os << "Agenda *" << mname << "* was changed after it was checked.\n"
+       << "Developer error: Call Agenda::check after modifying the method "
+       << "list of an agenda.";
+    throw runtime_error(os.str());
+  }
 
-  const Index wsv_id_verbosity = get_wsv_id("verbosity");
-  ws.duplicate(wsv_id_verbosity);
+  static const Index wsv_id_verbosity = get_wsv_id("verbosity");
 
-  Verbosity& averbosity = *((Verbosity*)ws[wsv_id_verbosity]);
+  const AgendaProfiler::Scope agenda_scope(mname);
 
-  averbosity.set_main_agenda(is_main_agenda());
+  // The agenda only needs its own verbosity if the main agenda flag
+  // differs from the caller's or if one of its methods sets verbosity
+  const bool dup_verbosity =
+      mdup_verbosity ||
+      ((Verbosity*)ws[wsv_id_verbosity])->is_main_agenda() != is_main_agenda();
+  if (dup_verbosity) {
+    ws.duplicate(wsv_id_verbosity);
+    ((Verbosity*)ws[wsv_id_verbosity])->set_main_agenda(is_main_agenda());
+  }
+
+  const Verbosity& averbosity = *((Verbosity*)ws[wsv_id_verbosity]);
 
   ArtsOut1 aout1(averbosity);
-  {
-    //    ostringstream os;  // disabled for performance reasons
-    //    os << "Executing " << name() << "\n"
-    //       << "{\n";
-    //    aout1 << os.str();
+  if (aout1.sufficient_priority()) {
     aout1 << "Executing " << name() << "\n"
           << "{\n";
   }
@@ -200,46 +260,35 @@ void Agenda::execute(Workspace& ws) const {
 
     // Runtime method data for this method:
     const MRecord& mrr = mml[i];
-    // Method data for this method:
-    const MdRecord& mdd = md_data[mrr.Id()];
+    // Execution plan for this method:
+    const MethodPlan& plan = mplan[i];
 
     try {
-      {
-        if (mrr.isInternal()) {
-          out3 << "- " + mdd.Name() + "\n";
-        } else {
-          out1 << "- " + mdd.Name() + "\n";
-        }
+      if (mrr.isInternal()) {
+        if (out3.sufficient_priority())
+          out3 << "- " + md_data[mrr.Id()].Name() + "\n";
+      } else {
+        if (out1.sufficient_priority())
+          out1 << "- " + md_data[mrr.Id()].Name() + "\n";
       }
 
-      {  // Check if all input variables are initialized:
-        const ArrayOfIndex& v(mrr.In());
-        for (Index s = 0; s < v.nelem(); ++s)
-          if ((s != v.nelem() - 1 || !mdd.SetMethod()) &&
-              !ws.is_initialized(v[s]))
-            throw runtime_error(
-                "Method " + mdd.Name() +
-                " needs input variable: " + Workspace::wsv_data[v[s]].Name());
-      }
-
-      {  // Check if all output variables which are also used as input
-        // are initialized
-        const ArrayOfIndex& v = mdd.InOut();
-        for (Index s = 0; s < v.nelem(); ++s)
-          if (!ws.is_initialized(mrr.Out()[v[s]]))
-            throw runtime_error("Method " + mdd.Name() +
-                                " needs input variable: " +
-                                Workspace::wsv_data[mrr.Out()[v[s]]].Name());
-      }
+      // Check if all input variables are initialized:
+      for (const Index v : plan.required)
+        if (!ws.is_initialized(v))
+          throw runtime_error("Method " + md_data[mrr.Id()].Name() +
+                              " needs input variable: " +
+                              Workspace::wsv_data[v].Name());
 
       // Call the getaway function:
-      getaways[mrr.Id()](ws, mrr);
+      const AgendaProfiler::Scope method_scope(md_data[mrr.Id()].Name());
+      plan.getaway(ws, mrr);
 
     } catch (const std::bad_alloc& x) {
       aout1 << "}\n";
 
       ostringstream os;
-      os << "Memory allocation error in method: " << mdd.Name() << '\n'
+      os << "Memory allocation error in method: " << md_data[mrr.Id()].Name()
+         << '\n'
          << "For memory intensive jobs it could help to limit the\n"
          << "number of threads with the -n option.\n"
          << x.what();
@@ -249,15 +298,16 @@ void Agenda::execute(Workspace& ws) const {
       aout1 << "}\n";
 
       ostringstream os;
-      os << "Run-time error in method: " << mdd.Name() << '\n' << x.what();
+      os << "Run-time error in method: " << md_data[mrr.Id()].Name() << '\n'
+         << x.what();
 
       throw runtime_error(os.str());
     }
   }
 
-  aout1 << "}\n";
+  if (aout1.sufficient_priority()) aout1 << "}\n";
 
-  ws.pop_free(wsv_id_verbosity);
+  if (dup_verbosity) ws.pop_free(wsv_id_verbosity);
 }
 
 //! Retrieve indexes of all input and output WSVs
@@ -647,6 +697,7 @@ bool Agenda::is_output(Index var) const {
 void Agenda::set_name(const String& nname) {
   mname = nname;
   mchecked = false;
+  mplan.resize(0);
 }
 
 //! Agenda name.
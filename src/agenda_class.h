@@ -49,7 +49,9 @@ class Agenda {
         moutput_push(),
         moutput_dup(),
         main_agenda(false),
-        mchecked(false) { /* Nothing to do here */
+        mchecked(false),
+        mplan(),
+        mdup_verbosity(true) { /* Nothing to do here */
   }
 
   /*! 
@@ -61,11 +63,14 @@ class Agenda {
         moutput_push(x.moutput_push),
         moutput_dup(x.moutput_dup),
         main_agenda(x.main_agenda),
-        mchecked(x.mchecked) { /* Nothing to do here */
+        mchecked(x.mchecked),
+        mplan(x.mplan),
+        mdup_verbosity(x.mdup_verbosity) { /* Nothing to do here */
   }
 
   void append(const String& methodname, const TokVal& keywordvalue);
   void check(Workspace& ws, const Verbosity& verbosity);
+  void compile();
   void push_back(const MRecord& n);
   void execute(Workspace& ws) const;
   inline void resize(Index n);
@@ -76,6 +81,7 @@ class Agenda {
   void set_methods(const Array<MRecord>& ml) {
     mml = ml;
     mchecked = false;
+    mplan.resize(0);
   }
   void set_outputs_to_push_and_dup(const Verbosity& verbosity);
   bool is_input(Workspace& ws, Index var) const;
@@ -88,6 +94,7 @@ class Agenda {
   void set_main_agenda() {
     main_agenda = true;
     mchecked = true;
+    compile();
   }
   bool is_main_agenda() const { return main_agenda; }
   bool checked() const { return mchecked; }
@@ -105,6 +112,21 @@ class Agenda {
 
   /** Flag indicating that the agenda was checked for consistency */
   bool mchecked;
+
+  /** Execution data of one method, resolved once by compile */
+  struct MethodPlan {
+    /** The getaway function of the method */
+    void (*getaway)(Workspace&, const MRecord&);
+    /** The WSVs that must be initialized before the method is called */
+    ArrayOfIndex required;
+  };
+
+  /** The execution plan, one entry per method in mml, empty after any
+      change of mml until the agenda is checked again */
+  Array<MethodPlan> mplan;
+
+  /** Does execute have to give the agenda its own copy of verbosity? */
+  bool mdup_verbosity;
 };
 
 // Documentation with implementation.
@@ -254,7 +276,10 @@ class MRecord {
 /*!
   Resizes the agenda's method list to n elements
  */
-inline void Agenda::resize(Index n) { mml.resize(n); }
+inline void Agenda::resize(Index n) {
+  mml.resize(n);
+  mplan.resize(0);
+}
 
 //! Return the number of agenda elements.
 /*!  
@@ -274,6 +299,7 @@ inline Index Agenda::nelem() const { return mml.nelem(); }
 inline void Agenda::push_back(const MRecord& n) {
   mml.push_back(n);
   mchecked = false;
+  mplan.resize(0);
 }
 
 //! Assignment operator.
@@ -286,6 +312,8 @@ inline Agenda& Agenda::operator=(const Agenda& x) {
   moutput_push = x.moutput_push;
   moutput_dup = x.moutput_dup;
   mchecked = x.mchecked;
+  mplan = x.mplan;
+  mdup_verbosity = x.mdup_verbosity;
   return *this;
 }
 
@@ -0,0 +1,183 @@
+/* Copyright (C) 2026
+   agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of the
+   License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA. */
+
+/** Per-method profiling of agenda execution.
+ *
+ * @file   agenda_profiler.cc
+ * @author agent <agent@local>
+ * @date   2026-10-18
+ */
+
+#include "agenda_profiler.h"
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+#include "file.h"
+
+namespace AgendaProfiler {
+
+bool active = false;
+
+thread_local AllocationCounter allocation_counter;
+
+using Clock = std::chrono::steady_clock;
+
+/** A node of the call tree */
+struct Node {
+  Index calls{0};
+  Numeric inclusive{0};
+  Numeric exclusive{0};
+  Index allocations{0};
+  Index bytes{0};
+  std::map<String, std::unique_ptr<Node>> children{};
+};
+
+/** A running call */
+struct Frame {
+  Node* node;
+  Clock::time_point start;
+  Numeric child_time;
+  Index allocations;
+  Index bytes;
+  Index child_allocations;
+  Index child_bytes;
+};
+
+/** The call tree and the running calls of one thread */
+struct ThreadProfile {
+  Index thread;
+  Node root{};
+  std::vector<Frame> stack{};
+};
+
+/** The profiles of all threads that have executed an agenda */
+std::vector<std::shared_ptr<ThreadProfile>> profiles;
+std::mutex profiles_mutex;
+
+thread_local std::shared_ptr<ThreadProfile> this_thread_profile;
+
+ThreadProfile& get_thread_profile() {
+  if (not this_thread_profile) {
+    std::lock_guard<std::mutex> lock(profiles_mutex);
+    this_thread_profile = std::make_shared<ThreadProfile>();
+    this_thread_profile->thread = Index(profiles.size());
+    profiles.push_back(this_thread_profile);
+  }
+  return *this_thread_profile;
+}
+
+void enable() { active = true; }
+
+void Scope::push(const String& name) {
+  AllocationCounter& c = allocation_counter;
+  c.paused = true;
+
+  ThreadProfile& prof = get_thread_profile();
+  Node& parent = prof.stack.empty() ? prof.root : *prof.stack.back().node;
+  std::unique_ptr<Node>& node = parent.children[name];
+  if (not node) node = std::make_unique<Node>();
+  prof.stack.push_back(Frame{node.get(), Clock::time_point{}, 0, 0, 0, 0, 0});
+
+  c.paused = false;
+
+  Frame& frame = prof.stack.back();
+  frame.allocations = c.count;
+  frame.bytes = c.bytes;
+  frame.start = Clock::now();
+}
+
+void Scope::pop() {
+  const Clock::time_point end = Clock::now();
+  AllocationCounter& c = allocation_counter;
+
+  ThreadProfile& prof = *this_thread_profile;
+  const Frame frame = prof.stack.back();
+  prof.stack.pop_back();
+
+  const Numeric inclusive =
+      std::chrono::duration<Numeric>(end - frame.start).count();
+  Node& node = *frame.node;
+  node.calls++;
+  node.inclusive += inclusive;
+  node.exclusive += inclusive - frame.child_time;
+
+  const Index allocations = c.count - frame.allocations;
+  const Index bytes = c.bytes - frame.bytes;
+  node.allocations += allocations - frame.child_allocations;
+  node.bytes += bytes - frame.child_bytes;
+
+  if (not prof.stack.empty()) {
+    Frame& parent = prof.stack.back();
+    parent.child_time += inclusive;
+    parent.child_allocations += allocations;
+    parent.child_bytes += bytes;
+  }
+}
+
+void print_node(std::ostream& os,
+                const String& name,
+                const Node& node,
+                const Index depth) {
+  const String label = String(2 * depth, ' ') + name;
+  os << std::left << std::setw(48) << label << std::right << std::setw(10)
+     << node.calls << std::fixed << std::setprecision(4) << std::setw(14)
+     << node.inclusive << std::setw(14) << node.exclusive << std::setw(12)
+     << node.allocations << std::setw(14) << node.bytes << '\n';
+  for (auto& child : node.children)
+    print_node(os, child.first, *child.second, depth + 1);
+}
+
+void print_table(std::ostream& os) {
+  std::lock_guard<std::mutex> lock(profiles_mutex);
+  for (auto& prof : profiles) {
+    os << "\nAgenda profile of thread " << prof->thread << ":\n"
+       << std::left << std::setw(48) << "Agenda / method" << std::right
+       << std::setw(10) << "Calls" << std::setw(14) << "Incl. [s]"
+       << std::setw(14) << "Excl. [s]" << std::setw(12) << "Allocs"
+       << std::setw(14) << "Bytes" << '\n';
+    for (auto& child : prof->root.children)
+      print_node(os, child.first, *child.second, 0);
+  }
+}
+
+void write_folded_node(std::ostream& os, const String& path, const Node& node) {
+  const auto us = Index(1e6 * node.exclusive);
+  if (us > 0) os << path << ' ' << us << '\n';
+  for (auto& child : node.children)
+    write_folded_node(os, path + ";" + child.first, *child.second);
+}
+
+void write_folded(const String& filename) {
+  std::ofstream os;
+  open_output_file(os, filename);
+
+  std::lock_guard<std::mutex> lock(profiles_mutex);
+  for (auto& prof : profiles) {
+    const String root = "thread " + std::to_string(prof->thread);
+    for (auto& child : prof->root.children)
+      write_folded_node(os, root + ";" + child.first, *child.second);
+  }
+}
+}  // namespace AgendaProfiler
@@ -0,0 +1,119 @@
+/* Copyright (C) 2026
+   agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of the
+   License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA. */
+
+/** Per-method profiling of agenda execution.
+ *
+ * @file   agenda_profiler.h
+ * @author agent <agent@local>
+ * @date   2026-10-18
+ *
+ * When active, Agenda::execute records every agenda and every method it
+ * runs in a call tree per thread. Each node of the tree holds the number
+ * of calls, the inclusive and exclusive wall time and the heap allocations
+ * made while the node was running.
+ *
+ * Allocations are only counted in programs that link the replacement
+ * operator new of agenda_profiler_alloc.cc, i.e. the arts executable.
+ */
+
+#ifndef agenda_profiler_h
+#define agenda_profiler_h
+
+#include <iosfwd>
+
+#include "arts.h"
+#include "mystring.h"
+
+namespace AgendaProfiler {
+
+/** True if agendas are being profiled. Set by enable */
+extern bool active;
+
+/** Heap allocations made by one thread */
+struct AllocationCounter {
+  Index count{0};
+  Index bytes{0};
+  /** Set while the profiler does its own bookkeeping */
+  bool paused{false};
+};
+
+/** The allocation counter of the calling thread */
+extern thread_local AllocationCounter allocation_counter;
+
+/** Count a heap allocation of the calling thread
+ *
+ * @param[in] size The size of the allocation in bytes
+ */
+inline void count_allocation(std::size_t size) noexcept {
+  if (active) {
+    AllocationCounter& c = allocation_counter;
+    if (not c.paused) {
+      c.count++;
+      c.bytes += Index(size);
+    }
+  }
+}
+
+/** Start profiling
+ *
+ * Must be called before any agenda is executed
+ */
+void enable();
+
+/** Records the time from construction to destruction as one call of name
+ *
+ * The node is a child of the innermost Scope that is alive on the same
+ * thread.  Does nothing if the profiler is not active
+ */
+class Scope {
+ public:
+  explicit Scope(const String& name) : on(active) {
+    if (on) push(name);
+  }
+
+  ~Scope() {
+    if (on) pop();
+  }
+
+  Scope(const Scope&) = delete;
+  Scope& operator=(const Scope&) = delete;
+
+ private:
+  static void push(const String& name);
+  static void pop();
+
+  bool on;
+};
+
+/** Print the call tree of every thread as a table
+ *
+ * @param[in,out] os The stream to write to
+ */
+void print_table(std::ostream& os);
+
+/** Write the call trees in the folded stack format of flamegraph.pl
+ *
+ * Every line holds the call stack, separated by ';' and starting with the
+ * thread, followed by the exclusive time in microseconds
+ *
+ * @param[in] filename The file to write
+ */
+void write_folded(const String& filename);
+}  // namespace AgendaProfiler
+
+#endif  // agenda_profiler_h
@@ -0,0 +1,50 @@
+/* Copyright (C) 2026
+   agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License as
+   published by the Free Software Foundation; either version 2 of the
+   License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+   USA. */
+
+/** Allocation counting for the agenda profiler.
+ *
+ * @file   agenda_profiler_alloc.cc
+ * @author agent <agent@local>
+ * @date   2026-10-18
+ *
+ * Replaces the global operator new and delete so that the agenda profiler
+ * can count heap allocations per method. Only linked into the arts
+ * executable, the libraries keep the default allocator.
+ */
+
+#include <cstdlib>
+#include <new>
+
+#include "agenda_profiler.h"
+
+void* operator new(std::size_t size) {
+  AgendaProfiler::count_allocation(size);
+
+  if (size == 0) size = 1;
+  for (;;) {
+    if (void* p = std::malloc(size)) return p;
+
+    std::new_handler handler = std::get_new_handler();
+    if (not handler) throw std::bad_alloc();
+    handler();
+  }
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
@@ -19,7 +19,8 @@ Index get_wsv_id(const char *);
 
 using global_data::MdMap;
 
-std::string string_buffer;
+/** Error messages of calls that are not bound to a workspace */
+thread_local std::string string_buffer;
 
 //extern "C" {
 
@@ -48,14 +49,24 @@ void copy_output_and_input(ArrayOfIndex &output,
 ////////////////////////////////////////////////////////////////////////////
 
 void include_path_push(const char *path) {
+  RegistryWriteLock lock;
   parameters.includepath.push_back(path);
 }
 
-void include_path_pop() { parameters.includepath.pop_back(); }
+void include_path_pop() {
+  RegistryWriteLock lock;
+  parameters.includepath.pop_back();
+}
 
-void data_path_push(const char *path) { parameters.datapath.push_back(path); }
+void data_path_push(const char *path) {
+  RegistryWriteLock lock;
+  parameters.datapath.push_back(path);
+}
 
-void data_path_pop() { parameters.datapath.pop_back(); }
+void data_path_pop() {
+  RegistryWriteLock lock;
+  parameters.datapath.pop_back();
+}
 
 void initialize() { InteractiveWorkspace::initialize(); }
 
@@ -65,12 +76,17 @@ void finalize() {
 
 const char *get_error() { return string_buffer.c_str(); }
 
-void set_basename(const char *name) { out_basename = name; }
+void set_basename(const char *name) {
+  RegistryWriteLock lock;
+  out_basename = name;
+}
 
 ////////////////////////////////////////////////////////////////////////////
 // Parsing and executing agendas.
 ////////////////////////////////////////////////////////////////////////////
 Agenda *parse_agenda(const char *filename) {
+  // The parser adds the variables that the controlfile creates
+  RegistryWriteLock lock;
   Agenda *a = new Agenda;
   ArtsParser parser = ArtsParser(*a, filename, verbosity_at_launch);
 
@@ -95,6 +111,7 @@ void agenda_insert_set(InteractiveWorkspace *workspace,
                        Agenda *a,
                        long id,
                        long group_id) {
+  RegistryReadLock lock;
   TokVal t{};
   ArrayOfIndex output(1), input(0);
   output[0] = id;
@@ -283,6 +300,7 @@ const char *method_print_doc(long id) {
 // Accessing and Manipulating WSVs
 ////////////////////////////////////////////////////////////////////////////
 long lookup_workspace_variable(const char *s) {
+  RegistryReadLock lock;
   auto it = Workspace::WsvMap.find(s);
   if (it == Workspace::WsvMap.end()) {
     return -1;
@@ -290,9 +308,13 @@ long lookup_workspace_variable(const char *s) {
   return it->second;
 }
 
-unsigned long get_number_of_variables() { return Workspace::wsv_data.size(); }
+unsigned long get_number_of_variables() {
+  RegistryReadLock lock;
+  return Workspace::wsv_data.size();
+}
 
 VariableStruct get_variable(Index i) {
+  RegistryReadLock lock;
   const WsvRecord &r = Workspace::wsv_data[i];
   return VariableStruct{r.Name().c_str(), r.Description().c_str(), r.Group()};
 }
@@ -300,6 +322,7 @@ VariableStruct get_variable(Index i) {
 VariableValueStruct get_variable_value(InteractiveWorkspace *workspace,
                                        Index id,
                                        Index group_id) {
+  RegistryReadLock lock;
   VariableValueStruct value{nullptr,
                             workspace->is_initialized(id),
                             {0, 0, 0, 0, 0, 0},
@@ -509,127 +532,145 @@ CovarianceMatrixBlockStruct get_covariance_matrix_block(CovarianceMatrix *m,
   return b;
 }
 
+VariableValueStruct resize_variable_value(InteractiveWorkspace *workspace,
+                                          long id,
+                                          long group_id,
+                                          VariableValueStruct value) {
+  RegistryReadLock lock;
+  try {
+    workspace->resize_tensor_variable(id, group_id, value.dimensions);
+  } catch (const std::exception &e) {
+    string_buffer = std::string(e.what());
+    return VariableValueStruct{
+        nullptr, false, {0, 0, 0, 0, 0, 0, 0}, nullptr, nullptr};
+  }
+  return get_variable_value(workspace, id, group_id);
+}
+
 const char *set_variable_value(InteractiveWorkspace *workspace,
                                long id,
                                long group_id,
                                VariableValueStruct value) {
-  // If ptr is null empty variable
-  if (value.ptr == nullptr) {
-    workspace->initialize_variable(id);
-  }
-  // Agenda
-  else if (wsv_group_names[group_id] == "Agenda") {
-    try {
+  RegistryReadLock lock;
+  // Agendas are checked and shared variables are rejected with an error
+  try {
+    // If ptr is null empty variable
+    if (value.ptr == nullptr) {
+      workspace->initialize_variable(id);
+    }
+    // Agenda
+    else if (wsv_group_names[group_id] == "Agenda") {
       const Agenda *ptr = reinterpret_cast<const Agenda *>(value.ptr);
       workspace->set_agenda_variable(id, *ptr);
-    } catch (const std::exception &e) {
-      string_buffer = std::string(e.what());
-      return string_buffer.c_str();
     }
-  }
-  // Index
-  else if (wsv_group_names[group_id] == "Index") {
-    const Index *ptr = reinterpret_cast<const Index *>(value.ptr);
-    workspace->set_index_variable(id, *ptr);
-  }
-  // Numeric
-  else if (wsv_group_names[group_id] == "Numeric") {
-    const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
-    workspace->set_numeric_variable(id, *ptr);
-  }
-  // String
-  else if (wsv_group_names[group_id] == "String") {
-    const char *ptr = reinterpret_cast<const char *>(value.ptr);
-    workspace->set_string_variable(id, ptr);
-  }
-  // Array of String
-  else if (wsv_group_names[group_id] == "ArrayOfString") {
-    const char *const *ptr = reinterpret_cast<const char *const *>(value.ptr);
-    workspace->set_array_of_string_variable(id, value.dimensions[0], ptr);
-  }
-  // Array of Index
-  else if (wsv_group_names[group_id] == "ArrayOfIndex") {
-    const Index *ptr = reinterpret_cast<const Index *>(value.ptr);
-    workspace->set_array_of_index_variable(id, value.dimensions[0], ptr);
-  }
-  // Vector
-  else if (wsv_group_names[group_id] == "Vector") {
-    const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
-    workspace->set_vector_variable(id, value.dimensions[0], ptr);
-  }
-  // Matrix
-  else if (wsv_group_names[group_id] == "Matrix") {
-    const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
-    workspace->set_matrix_variable(
-        id, value.dimensions[0], value.dimensions[1], ptr);
-  }
-  // Tensor3
-  else if (wsv_group_names[group_id] == "Tensor3") {
-    const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
-    workspace->set_tensor3_variable(
-        id, value.dimensions[0], value.dimensions[1], value.dimensions[2], ptr);
-  }
-  // Tensor4
-  else if (wsv_group_names[group_id] == "Tensor4") {
-    const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
-    workspace->set_tensor4_variable(id,
-                                    value.dimensions[0],
-                                    value.dimensions[1],
-                                    value.dimensions[2],
-                                    value.dimensions[3],
-                                    ptr);
-  }
-  // Tensor5
-  else if (wsv_group_names[group_id] == "Tensor5") {
-    const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
-    workspace->set_tensor5_variable(id,
-                                    value.dimensions[0],
-                                    value.dimensions[1],
-                                    value.dimensions[2],
-                                    value.dimensions[3],
-                                    value.dimensions[4],
-                                    ptr);
-  }
-  // Tensor6
-  else if (wsv_group_names[group_id] == "Tensor6") {
-    const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
-    workspace->set_tensor6_variable(id,
-                                    value.dimensions[0],
-                                    value.dimensions[1],
-                                    value.dimensions[2],
-                                    value.dimensions[3],
-                                    value.dimensions[4],
-                                    value.dimensions[5],
-                                    ptr);
-  }
-  // Tensor7
-  else if (wsv_group_names[group_id] == "Tensor7") {
-    const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
-    workspace->set_tensor7_variable(id,
-                                    value.dimensions[0],
-                                    value.dimensions[1],
-                                    value.dimensions[2],
-                                    value.dimensions[3],
-                                    value.dimensions[4],
-                                    value.dimensions[5],
-                                    value.dimensions[6],
-                                    ptr);
-  }
-  // Sparse
-  else if (wsv_group_names[group_id] == "Sparse") {
-    const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
-    workspace->set_sparse_variable(id,
-                                   value.dimensions[0],
-                                   value.dimensions[1],
-                                   value.dimensions[2],
-                                   ptr,
-                                   value.inner_ptr,
-                                   value.outer_ptr);
-  } else {
-    string_buffer = std::string(
-        "This variable can currently not be set through the C API."
-        " Signal your need to ARTS dev mailing list.");
-    return string_buffer.c_str();
+    // Index
+    else if (wsv_group_names[group_id] == "Index") {
+      const Index *ptr = reinterpret_cast<const Index *>(value.ptr);
+      workspace->set_index_variable(id, *ptr);
+    }
+    // Numeric
+    else if (wsv_group_names[group_id] == "Numeric") {
+      const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
+      workspace->set_numeric_variable(id, *ptr);
+    }
+    // String
+    else if (wsv_group_names[group_id] == "String") {
+      const char *ptr = reinterpret_cast<const char *>(value.ptr);
+      workspace->set_string_variable(id, ptr);
+    }
+    // Array of String
+    else if (wsv_group_names[group_id] == "ArrayOfString") {
+      const char *const *ptr = reinterpret_cast<const char *const *>(value.ptr);
+      workspace->set_array_of_string_variable(id, value.dimensions[0], ptr);
+    }
+    // Array of Index
+    else if (wsv_group_names[group_id] == "ArrayOfIndex") {
+      const Index *ptr = reinterpret_cast<const Index *>(value.ptr);
+      workspace->set_array_of_index_variable(id, value.dimensions[0], ptr);
+    }
+    // Vector
+    else if (wsv_group_names[group_id] == "Vector") {
+      const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
+      workspace->set_vector_variable(id, value.dimensions[0], ptr);
+    }
+    // Matrix
+    else if (wsv_group_names[group_id] == "Matrix") {
+      const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
+      workspace->set_matrix_variable(
+          id, value.dimensions[0], value.dimensions[1], ptr);
+    }
+    // Tensor3
+    else if (wsv_group_names[group_id] == "Tensor3") {
+      const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
+      workspace->set_tensor3_variable(id,
+                                      value.dimensions[0],
+                                      value.dimensions[1],
+                                      value.dimensions[2],
+                                      ptr);
+    }
+    // Tensor4
+    else if (wsv_group_names[group_id] == "Tensor4") {
+      const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
+      workspace->set_tensor4_variable(id,
+                                      value.dimensions[0],
+                                      value.dimensions[1],
+                                      value.dimensions[2],
+                                      value.dimensions[3],
+                                      ptr);
+    }
+    // Tensor5
+    else if (wsv_group_names[group_id] == "Tensor5") {
+      const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
+      workspace->set_tensor5_variable(id,
+                                      value.dimensions[0],
+                                      value.dimensions[1],
+                                      value.dimensions[2],
+                                      value.dimensions[3],
+                                      value.dimensions[4],
+                                      ptr);
+    }
+    // Tensor6
+    else if (wsv_group_names[group_id] == "Tensor6") {
+      const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
+      workspace->set_tensor6_variable(id,
+                                      value.dimensions[0],
+                                      value.dimensions[1],
+                                      value.dimensions[2],
+                                      value.dimensions[3],
+                                      value.dimensions[4],
+                                      value.dimensions[5],
+                                      ptr);
+    }
+    // Tensor7
+    else if (wsv_group_names[group_id] == "Tensor7") {
+      const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
+      workspace->set_tensor7_variable(id,
+                                      value.dimensions[0],
+                                      value.dimensions[1],
+                                      value.dimensions[2],
+                                      value.dimensions[3],
+                                      value.dimensions[4],
+                                      value.dimensions[5],
+                                      value.dimensions[6],
+                                      ptr);
+    }
+    // Sparse
+    else if (wsv_group_names[group_id] == "Sparse") {
+      const Numeric *ptr = reinterpret_cast<const Numeric *>(value.ptr);
+      workspace->set_sparse_variable(id,
+                                     value.dimensions[0],
+                                     value.dimensions[1],
+                                     value.dimensions[2],
+                                     ptr,
+                                     value.inner_ptr,
+                                     value.outer_ptr);
+    } else {
+      return workspace->set_error(
+          "This variable can currently not be set through the C API."
+          " Signal your need to ARTS dev mailing list.");
+    }
+  } catch (const std::exception &e) {
+    return workspace->set_error(e.what());
   }
   return nullptr;
 }
@@ -641,8 +682,27 @@ long add_variable(InteractiveWorkspace *workspace,
 }
 
 DLL_PUBLIC
-void erase_variable(InteractiveWorkspace *workspace, long id, long group_id) {
-  return workspace->erase_variable(id, group_id);
+const char *erase_variable(InteractiveWorkspace *workspace,
+                           long id,
+                           long group_id) {
+  try {
+    workspace->erase_variable(id, group_id);
+  } catch (const std::exception &e) {
+    return workspace->set_error(e.what());
+  }
+  return nullptr;
+}
+
+DLL_PUBLIC
+const char *share_variable(InteractiveWorkspace *dst,
+                           InteractiveWorkspace *src,
+                           long id) {
+  try {
+    dst->share_variable(id, *src);
+  } catch (const std::exception &e) {
+    return dst->set_error(e.what());
+  }
+  return nullptr;
 }
 
 DLL_PUBLIC
@@ -279,7 +279,11 @@ void finalize();
 
 /** Get most recent error.
  *
- * @return Pointer to the c string holding the most recent error message.
+ * The error buffer is kept per thread. Errors of calls that take a
+ * workspace and return an error message are stored in the workspace.
+ *
+ * @return Pointer to the c string holding the most recent error message
+ * of the calling thread.
  */
 DLL_PUBLIC
 const char *get_error();
@@ -603,6 +607,9 @@ CovarianceMatrixBlockStruct get_covariance_matrix_block(CovarianceMatrix *m,
  * @param workspace Pointer to a InteractiveWorkspace object.
  * @param id Index of the workspace variable.
  * @param group_id Index of the group the variable belongs to.
+ * Variables that are shared from another workspace cannot be set, only
+ * re-initialized by passing a null data pointer.
+ *
  * @return Poiter to null-terminated string containing the error message if setting of
  * variable fails.
  */
@@ -611,6 +618,31 @@ const char *set_variable_value(InteractiveWorkspace *workspace,
                                long id,
                                long group_id,
                                VariableValueStruct value);
+
+/** Resize tensor WSV in given workspace.
+ *
+ * Resizes a variable of group Vector, Matrix or Tensor3, ..., Tensor7 to the
+ * shape given in the dimension field of the VariableValueStruct and returns
+ * access to it like get_variable_value. The returned data pointer can be
+ * used to fill the variable in place. Setting the variable with
+ * set_variable_value from the same memory afterwards does not copy.
+ *
+ * The memory stays valid until the variable is resized or erased, in
+ * particular by a workspace method that writes to it.
+ *
+ * @param workspace Pointer to a InteractiveWorkspace object.
+ * @param id Index of the workspace variable.
+ * @param group_id Index of the group the variable belongs to.
+ * @param value VariableValueStruct holding the new shape in its dimensions.
+ * @return VariableValueStruct providing access to the variable. The data
+ * pointer is NULL if the variable could not be resized, the error message
+ * is then available through get_error.
+ */
+DLL_PUBLIC
+VariableValueStruct resize_variable_value(InteractiveWorkspace *workspace,
+                                          long id,
+                                          long group_id,
+                                          VariableValueStruct value);
 /** Add variable of given type to workspace.
  *
  * This adds and initializes a variable in the current workspace and also
@@ -631,15 +663,43 @@ long add_variable(InteractiveWorkspace *workspace,
 /** Erase variable from workspace.
  *
  * This variable removes a variable from the workspace and the global wsv_data
- * and WsvMap. This is likely to invalidate indices of existing variables so it
- * should be used with care.
+ * and WsvMap. The index of the variable is reused by the next variable that
+ * is added, the indices of all other variables stay valid.
+ *
+ * A variable that a workspace holds while it executes cannot be erased from
+ * a callback of the execution, unless the variable was added after the
+ * execution started.
  *
  * @param workspace Pointer to the InteractiveWorkspace object owning the variable
  * @param id The index of the variable
  * @param group_id The index of the group of the variable
+ * @return NULL on success, otherwise a pointer to a null-terminated error
+ * message.
+ */
+DLL_PUBLIC
+const char *erase_variable(InteractiveWorkspace *workspace,
+                           long id,
+                           long group_id);
+
+/** Share variable between workspaces.
+ *
+ * Makes the variable with the given index of src available in dst without
+ * copying it. Useful to give several workspaces that run in parallel
+ * access to large read-only data such as absorption lookup tables. Setting
+ * or resizing the variable in dst fails until it is re-initialized there,
+ * which drops the shared reference. src must outlive dst or the variable
+ * must be erased from dst first.
+ *
+ * @param dst Pointer to the InteractiveWorkspace that receives the variable.
+ * @param src Pointer to the InteractiveWorkspace that holds the variable.
+ * @param id The index of the variable
+ * @return NULL on success, otherwise a pointer to a null-terminated error
+ * message.
  */
 DLL_PUBLIC
-void erase_variable(InteractiveWorkspace *workspace, long id, long group_id);
+const char *share_variable(InteractiveWorkspace *dst,
+                           InteractiveWorkspace *src,
+                           long id);
 
 /** Get ARTS Version
  *
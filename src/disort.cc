@@ -27,10 +27,13 @@
 #include "disort.h"
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <numeric>
 #include <stdexcept>
 #include "agenda_class.h"
 #include "array.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "check_input.h"
 
@@ -40,6 +43,7 @@ extern "C" {
 
 #include "disort.h"
 #include "interpolation.h"
+#include "interpolation_poly.h"
 #include "logic.h"
 #include "math_funcs.h"
 #include "messages.h"
@@ -623,6 +627,230 @@ void get_pmom(Tensor3View pmom,
       }
 }
 
+bool get_phase_cache(DisortPhaseCache& cache,
+                     const ArrayOfArrayOfSingleScatteringData& scat_data,
+                     ConstVectorView pfct_angs,
+                     const Index& Nlegendre) {
+  const Index nang = pfct_angs.nelem();
+
+  std::vector<const Numeric*> pha_mat_data;
+  std::vector<Numeric> pha_mat_sum;
+  for (auto& ss : scat_data)
+    for (auto& ssd : ss) {
+      const Tensor7& pha = ssd.pha_mat_data;
+      const Numeric* data = pha.get_c_array();
+      const Index n = pha.nlibraries() * pha.nvitrines() * pha.nshelves() *
+                      pha.nbooks() * pha.npages() * pha.nrows() * pha.ncols();
+      pha_mat_data.push_back(data);
+      pha_mat_sum.push_back(std::accumulate(data, data + n, Numeric(0)));
+    }
+
+  bool same = cache.scat_data == &scat_data and
+              cache.pha_mat_data == pha_mat_data and
+              cache.pha_mat_sum == pha_mat_sum and
+              cache.Nlegendre == Nlegendre and
+              cache.pfct_angs.nelem() == nang;
+  for (Index ia = 0; same and ia < nang; ia++)
+    same = cache.pfct_angs[ia] == pfct_angs[ia];
+  if (same) return false;
+
+  cache.scat_data = &scat_data;
+  cache.pha_mat_data = pha_mat_data;
+  cache.pha_mat_sum = pha_mat_sum;
+  cache.pfct_angs = pfct_angs;
+  cache.Nlegendre = Nlegendre;
+  cache.pha0.resize(0);
+  cache.legendre.resize(0);
+
+  // Legendre polynomials at the ends of each angular interval, as in
+  // get_pmom
+  Vector u(nang), adu(nang - 1);
+  Tensor3 px(nang - 1, Nlegendre, 2, 0.);
+  u[0] = cos(pfct_angs[0] * PI / 180.);
+  px(joker, 0, joker) = 1.;
+  for (Index ia = 1; ia < nang; ia++) {
+    u[ia] = cos(pfct_angs[ia] * PI / 180.);
+    adu[ia - 1] = abs(u[ia] - u[ia - 1]);
+    px(ia - 1, 1, 0) = u[ia - 1];
+    px(ia - 1, 1, 1) = u[ia];
+    for (Index l = 2; l < Nlegendre; l++) {
+      Numeric dl = (double)l;
+      px(ia - 1, l, 0) = (2 * dl - 1) / dl * u[ia - 1] * px(ia - 1, l - 1, 0) -
+                         (dl - 1) / dl * px(ia - 1, l - 2, 0);
+      px(ia - 1, l, 1) = (2 * dl - 1) / dl * u[ia] * px(ia - 1, l - 1, 1) -
+                         (dl - 1) / dl * px(ia - 1, l - 2, 1);
+    }
+  }
+
+  // Directions as in get_parZ
+  Matrix idir_array(1, 2, 0.);
+  Matrix pdir_array(nang, 2, 0.);
+  pdir_array(joker, 0) = pfct_angs;
+
+  const Index nf = scat_data[0][0].pha_mat_data.nlibraries();
+  for (auto& ss : scat_data)
+    for (auto& ssd : ss) {
+      // The phase function at the temperature grid points of the element
+      const Index nT = ssd.T_grid.nelem();
+      Tensor6 pha(nf, nT, nang, 1, 1, 1);
+      Vector t_ok(nT);
+      Index ptype;
+      pha_mat_1ScatElem(
+          pha, ptype, t_ok, ssd, ssd.T_grid, pdir_array, idir_array, 0);
+
+      Matrix pha0(nf, nT);
+      Tensor3 legendre(nf, nT, Nlegendre, 0.);
+      for (Index f_index = 0; f_index < nf; f_index++)
+        for (Index iT = 0; iT < nT; iT++) {
+          pha0(f_index, iT) = pha(f_index, iT, 0, 0, 0, 0);
+          for (Index ia = 0; ia < nang - 1; ia++)
+            for (Index l = 0; l < Nlegendre; l++)
+              legendre(f_index, iT, l) +=
+                  0.25 * adu[ia] *
+                  (px(ia, l, 0) * pha(f_index, iT, ia, 0, 0, 0) +
+                   px(ia, l, 1) * pha(f_index, iT, ia + 1, 0, 0, 0));
+        }
+      cache.pha0.push_back(std::move(pha0));
+      cache.legendre.push_back(std::move(legendre));
+    }
+  return true;
+}
+
+//! The cache of the innermost DisortPhaseCacheScope of this thread
+thread_local DisortPhaseCache* disort_phase_cache_current = nullptr;
+
+DisortPhaseCacheScope::DisortPhaseCacheScope(DisortPhaseCache& cache)
+    : mprevious(disort_phase_cache_current) {
+  disort_phase_cache_current = &cache;
+}
+
+DisortPhaseCacheScope::~DisortPhaseCacheScope() {
+  disort_phase_cache_current = mprevious;
+}
+
+DisortPhaseCache& DisortPhaseCacheScope::Current(DisortPhaseCache& own_cache) {
+  return disort_phase_cache_current ? *disort_phase_cache_current : own_cache;
+}
+
+void get_pmom_cached(Tensor3View pmom,
+                     const DisortPhaseCache& cache,
+                     const ArrayOfArrayOfSingleScatteringData& scat_data,
+                     ConstMatrixView pnd_profiles,
+                     ConstVectorView t_profile,
+                     ConstMatrixView ext_bulk_par,
+                     ConstMatrixView abs_bulk_par,
+                     const ArrayOfIndex& cloudbox_limits) {
+  const Index Np_cloud = pnd_profiles.ncols();
+  const Index Np = t_profile.nelem();
+  const Index nf = pmom.npages();
+  const Index nlyr = pmom.nrows();
+  const Index Nlegendre = pmom.ncols();
+
+  assert(nlyr == Np - 1);
+  assert(Nlegendre == cache.Nlegendre);
+
+  Numeric pfct_threshold = 0.1;
+
+  // Level based bulk phase function at the first angle and Legendre
+  // integrals, pnd-weighted sums of the T-interpolated element values
+  Matrix pha0_bulk(nf, Np, 0.);
+  Tensor3 legendre_bulk(nf, Np, Nlegendre, 0.);
+
+  const Vector T_array = t_profile[Range(cloudbox_limits[0], Np_cloud)];
+  Index i_se_flat = 0;
+  for (auto& ss : scat_data)
+    for (auto& ssd : ss) {
+      const Matrix& pha0 = cache.pha0[i_se_flat];
+      const Tensor3& legendre = cache.legendre[i_se_flat];
+
+      Vector t_ok(Np_cloud);
+      Index this_T_interp_order;
+      Matrix T_itw;
+      ArrayOfGridPosPoly T_gp(Np_cloud);
+      ssd_tinterp_parameters(
+          t_ok, this_T_interp_order, T_gp, T_itw, ssd.T_grid, T_array, 1);
+
+      for (Index i = 0; i < Np_cloud; i++) {
+        const Numeric pnd = pnd_profiles(i_se_flat, i);
+        if (pnd == 0.) continue;
+        if (t_ok[i] < 0.) {
+          ostringstream os;
+          os << "Interpolation error for (flat-array) scattering element #"
+             << i_se_flat << "\n"
+             << "at location/temperature point #" << i << "\n";
+          throw runtime_error(os.str());
+        }
+
+        const Index ip = cloudbox_limits[0] + i;
+        for (Index f_index = 0; f_index < nf; f_index++) {
+          if (this_T_interp_order < 0) {
+            pha0_bulk(f_index, ip) += pnd * pha0(f_index, 0);
+            for (Index l = 0; l < Nlegendre; l++)
+              legendre_bulk(f_index, ip, l) += pnd * legendre(f_index, 0, l);
+          } else {
+            pha0_bulk(f_index, ip) +=
+                pnd * interp(T_itw(i, joker), pha0(f_index, joker), T_gp[i]);
+            for (Index l = 0; l < Nlegendre; l++)
+              legendre_bulk(f_index, ip, l) +=
+                  pnd * interp(T_itw(i, joker),
+                               legendre(f_index, joker, l),
+                               T_gp[i]);
+          }
+        }
+      }
+      i_se_flat++;
+    }
+
+  // Layer averages, as in get_pfct. The 4Pi/sca scaling of the phase
+  // function cancels in the moments but enters the normalization check.
+  Matrix pfct0(nf, nlyr, 0.);
+  Tensor3 legendre_lyr(nf, nlyr, Nlegendre, 0.);
+  const Index Np_cbox = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+  for (Index ip = cloudbox_limits[0]; ip < Np_cbox - 1; ip++)
+    for (Index f_index = 0; f_index < nf; f_index++) {
+      Numeric sca =
+          (ext_bulk_par(f_index, ip) + ext_bulk_par(f_index, ip + 1)) -
+          (abs_bulk_par(f_index, ip) + abs_bulk_par(f_index, ip + 1));
+      if (sca != 0.) {
+        const Numeric fac = 4 * PI / sca;
+        pfct0(f_index, Np - 2 - ip) =
+            fac * (pha0_bulk(f_index, ip) + pha0_bulk(f_index, ip + 1));
+        for (Index l = 0; l < Nlegendre; l++)
+          legendre_lyr(f_index, Np - 2 - ip, l) =
+              fac * (legendre_bulk(f_index, ip, l) +
+                     legendre_bulk(f_index, ip + 1, l));
+      }
+    }
+
+  // Initialization
+  pmom = 0.;
+
+  for (Index il = 0; il < nlyr; il++)
+    if (pfct0(joker, il).sum() != 0.)
+      for (Index f_index = 0; f_index < nf; f_index++) {
+        if (pfct0(f_index, il) != 0) {
+          // Check if phase function is properly normalized
+          const Numeric pint = 2 * legendre_lyr(f_index, il, 0);
+
+          if (abs(pint / 2. - 1.) > pfct_threshold) {
+            ostringstream os;
+            os << "Phase function normalization deviates from expected value by\n"
+               << 1e2 * pint / 2. - 1e2 << "(allowed: " << pfct_threshold * 1e2
+               << "%).\n"
+               << "Occurs at layer #" << il << " and frequency #" << f_index
+               << ".\n"
+               << "Something is wrong with your scattering data. Check!\n";
+            throw runtime_error(os.str());
+          }
+
+          // for the rest, rescale pfct to norm 2
+          pmom(f_index, il, 0) = 1.;
+          for (Index l = 1; l < Nlegendre; l++)
+            pmom(f_index, il, l) = legendre_lyr(f_index, il, l) * 2. / pint;
+        }
+      }
+}
+
 // Use a thread_local variable to communicate the Verbosity to the
 // Disort error and warning functions. Ugly workaround, to avoid
 // passing a Verbosity argument throughout the whole cdisort code.
@@ -784,6 +1012,8 @@ void run_cdisort(Workspace& ws,
                  const Index& nstreams,
                  const Index& Npfct,
                  const Index& quiet,
+                 const Index& f_chunk_size,
+                 DisortPhaseCache& phase_cache,
                  const Verbosity& verbosity) {
   // Create an atmosphere starting at z_surface
   Vector p, z, t;
@@ -806,115 +1036,123 @@ void run_cdisort(Workspace& ws,
                 pnd_profiles,
                 cloudbox_limits);
 
-  disort_state ds;
-  disort_output out;
-
-  if (quiet == 0)
-    disort_verbosity = verbosity;
-  else
-    disort_verbosity = Verbosity(0, 0, 0);
+  const Verbosity cdisort_verbosity =
+      quiet == 0 ? verbosity : Verbosity(0, 0, 0);
+  disort_verbosity = cdisort_verbosity;
 
   const Index nf = f_grid.nelem();
-
-  ds.accur = 0.005;
-  ds.flag.prnt[0] = FALSE;
-  ds.flag.prnt[1] = FALSE;
-  ds.flag.prnt[2] = FALSE;
-  ds.flag.prnt[3] = FALSE;
-  ds.flag.prnt[4] = TRUE;
-
-  ds.flag.usrtau = FALSE;
-  ds.flag.usrang = TRUE;
-  ds.flag.spher = FALSE;
-  ds.flag.general_source = FALSE;
-  ds.flag.output_uum = FALSE;
-
-  ds.nlyr = static_cast<int>(p.nelem() - 1);
-
-  ds.flag.brdf_type = BRDF_NONE;
-
-  ds.flag.ibcnd = GENERAL_BC;
-  ds.flag.usrang = TRUE;
-  ds.flag.planck = TRUE;
-  ds.flag.onlyfl = FALSE;
-  ds.flag.lamber = TRUE;
-  ds.flag.quiet = FALSE;
-  ds.flag.intensity_correction = TRUE;
-  ds.flag.old_intensity_correction = TRUE;
-
-  ds.nstr = static_cast<int>(nstreams);
-  ds.nphase = ds.nstr;
-  ds.nmom = ds.nstr;
-  //ds.ntau = ds.nlyr + 1;   // With ds.flag.usrtau = FALSE; set by cdisort
-  ds.numu = static_cast<int>(za_grid.nelem());
-  ds.nphi = 1;
-  Index Nlegendre = nstreams + 1;
-
-  /* Allocate memory */
-  c_disort_state_alloc(&ds);
-  c_disort_out_alloc(&ds, &out);
-
-  // Properties of solar beam, set to zero as they are not needed
-  ds.bc.fbeam = 0.;
-  ds.bc.umu0 = 0.;
-  ds.bc.phi0 = 0.;
-  ds.bc.fluor = 0.;
-
-  // Since we have no solar source there is no angular dependance
-  ds.phi[0] = 0.;
-
-  for (Index i = 0; i <= ds.nlyr; i++) ds.temper[i] = t[ds.nlyr - i];
-
-  Matrix ext_bulk_gas(nf, ds.nlyr + 1);
+  const Index nlyr = p.nelem() - 1;
+  const Index Nlegendre = nstreams + 1;
+
+  // Sets up and allocates a DISORT state and output. The settings are the
+  // same for all frequencies.
+  const auto init_disort = [&](disort_state& ds, disort_output& out) {
+    ds.accur = 0.005;
+    ds.flag.prnt[0] = FALSE;
+    ds.flag.prnt[1] = FALSE;
+    ds.flag.prnt[2] = FALSE;
+    ds.flag.prnt[3] = FALSE;
+    ds.flag.prnt[4] = TRUE;
+
+    ds.flag.usrtau = FALSE;
+    ds.flag.usrang = TRUE;
+    ds.flag.spher = FALSE;
+    ds.flag.general_source = FALSE;
+    ds.flag.output_uum = FALSE;
+
+    ds.nlyr = static_cast<int>(nlyr);
+
+    ds.flag.brdf_type = BRDF_NONE;
+
+    ds.flag.ibcnd = GENERAL_BC;
+    ds.flag.usrang = TRUE;
+    ds.flag.planck = TRUE;
+    ds.flag.onlyfl = FALSE;
+    ds.flag.lamber = TRUE;
+    ds.flag.quiet = FALSE;
+    ds.flag.intensity_correction = TRUE;
+    ds.flag.old_intensity_correction = TRUE;
+
+    ds.nstr = static_cast<int>(nstreams);
+    ds.nphase = ds.nstr;
+    ds.nmom = ds.nstr;
+    //ds.ntau = ds.nlyr + 1;   // With ds.flag.usrtau = FALSE; set by cdisort
+    ds.numu = static_cast<int>(za_grid.nelem());
+    ds.nphi = 1;
+
+    /* Allocate memory */
+    c_disort_state_alloc(&ds);
+    c_disort_out_alloc(&ds, &out);
+
+    // Properties of solar beam, set to zero as they are not needed
+    ds.bc.fbeam = 0.;
+    ds.bc.umu0 = 0.;
+    ds.bc.phi0 = 0.;
+    ds.bc.fluor = 0.;
+
+    // Since we have no solar source there is no angular dependance
+    ds.phi[0] = 0.;
+
+    for (Index i = 0; i <= ds.nlyr; i++) ds.temper[i] = t[ds.nlyr - i];
+
+    // Transform to mu, starting with negative values
+    for (Index i = 0; i < ds.numu; i++)
+      ds.umu[i] = -cos(za_grid[i] * PI / 180);
+
+    //upper boundary conditions:
+    // DISORT offers isotropic incoming radiance or emissivity-scaled planck
+    // emission. Both are applied additively.
+    // We want to have cosmic background radiation, for which
+    // ttemp=COSMIC_BG_TEMP and temis=1 should give identical results to
+    // fisot(COSMIC_BG_TEMP). As they are additive we should use either the
+    // one or the other.
+    // Note: previous setup (using fisot) setting temis=0 should be avoided.
+    // Generally, temis!=1 should be avoided since that technically implies a
+    // reflective upper boundary (though it seems that this is not exploited
+    // in DISORT1.2, which we so far use).
+
+    // Cosmic background
+    // we use temis*ttemp as upper boundary specification, hence CBR set to 0.
+    ds.bc.fisot = 0;
+
+    // Top of the atmosphere temperature and emissivity
+    ds.bc.ttemp = COSMIC_BG_TEMP;
+    ds.bc.btemp = surface_skin_t;
+    ds.bc.temis = 1.;
+  };
+
+  Matrix ext_bulk_gas(nf, nlyr + 1);
   get_gasoptprop(ws, ext_bulk_gas, propmat_clearsky_agenda, t, vmr, p, f_grid);
-  Matrix ext_bulk_par(nf, ds.nlyr + 1), abs_bulk_par(nf, ds.nlyr + 1);
+  Matrix ext_bulk_par(nf, nlyr + 1), abs_bulk_par(nf, nlyr + 1);
   get_paroptprop(
       ext_bulk_par, abs_bulk_par, scat_data, pnd, t, p, cboxlims, f_grid);
 
   // Optical depth of layers
-  Matrix dtauc(nf, ds.nlyr);
+  Matrix dtauc(nf, nlyr);
   // Single scattering albedo of layers
-  Matrix ssalb(nf, ds.nlyr);
+  Matrix ssalb(nf, nlyr);
   get_dtauc_ssalb(dtauc, ssalb, ext_bulk_gas, ext_bulk_par, abs_bulk_par, z);
 
-  // Transform to mu, starting with negative values
-  for (Index i = 0; i < ds.numu; i++) ds.umu[i] = -cos(za_grid[i] * PI / 180);
-
-  //upper boundary conditions:
-  // DISORT offers isotropic incoming radiance or emissivity-scaled planck
-  // emission. Both are applied additively.
-  // We want to have cosmic background radiation, for which ttemp=COSMIC_BG_TEMP
-  // and temis=1 should give identical results to fisot(COSMIC_BG_TEMP). As they
-  // are additive we should use either the one or the other.
-  // Note: previous setup (using fisot) setting temis=0 should be avoided.
-  // Generally, temis!=1 should be avoided since that technically implies a
-  // reflective upper boundary (though it seems that this is not exploited in
-  // DISORT1.2, which we so far use).
-
-  // Cosmic background
-  // we use temis*ttemp as upper boundary specification, hence CBR set to 0.
-  ds.bc.fisot = 0;
-
-  // Top of the atmosphere temperature and emissivity
-  ds.bc.ttemp = COSMIC_BG_TEMP;
-  ds.bc.btemp = surface_skin_t;
-  ds.bc.temis = 1.;
-
   Vector pfct_angs;
   get_angs(pfct_angs, scat_data, Npfct);
-  Index nang = pfct_angs.nelem();
-
-  Index nf_ssd = scat_data[0][0].f_grid.nelem();
-  Tensor3 pha_bulk_par(nf_ssd, ds.nlyr + 1, nang);
-  get_parZ(pha_bulk_par, scat_data, pnd, t, pfct_angs, cboxlims);
-  Tensor3 pfct_bulk_par(nf_ssd, ds.nlyr, nang);
-  get_pfct(pfct_bulk_par, pha_bulk_par, ext_bulk_par, abs_bulk_par, cboxlims);
 
   // Legendre polynomials of phase function
-  Tensor3 pmom(nf_ssd, ds.nlyr, Nlegendre, 0.);
-  get_pmom(pmom, pfct_bulk_par, pfct_angs, Nlegendre);
-
-  for (Index f_index = 0; f_index < f_grid.nelem(); f_index++) {
+  Index nf_ssd = scat_data[0][0].f_grid.nelem();
+  Tensor3 pmom(nf_ssd, nlyr, Nlegendre, 0.);
+  get_phase_cache(phase_cache, scat_data, pfct_angs, Nlegendre);
+  get_pmom_cached(pmom,
+                  phase_cache,
+                  scat_data,
+                  pnd,
+                  t,
+                  ext_bulk_par,
+                  abs_bulk_par,
+                  cboxlims);
+
+  // Runs DISORT for one frequency and sorts the output into cloudbox_field
+  const auto run_frequency = [&](disort_state& ds,
+                                 disort_output& out,
+                                 const Index f_index) {
     sprintf(ds.header, "ARTS Calc f_index = %ld", f_index);
 
     std::memcpy(ds.dtauc,
@@ -950,11 +1188,48 @@ void run_cdisort(Workspace& ws,
             cloudbox_field(f_index, k + 1, 0, 0, j, 0, 0);
       }
     }
+  };
+
+  if (nf == 0) return;
+
+  // cdisort sets up some constants (and runs a self test) in static
+  // variables at its first call, so the first frequency is done before
+  // the threads are started
+  {
+    disort_state ds;
+    disort_output out;
+    init_disort(ds, out);
+    run_frequency(ds, out, 0);
+
+    /* Free allocated memory */
+    c_disort_out_free(&ds, &out);
+    c_disort_state_free(&ds);
   }
 
-  /* Free allocated memory */
-  c_disort_out_free(&ds, &out);
-  c_disort_state_free(&ds);
+  // Each thread allocates a state and output of its own, and reuses them
+  // for all its frequencies. Without a chunk size, each thread gets one
+  // contiguous part of the remaining frequencies.
+  const Index nthreads =
+      min(Index(arts_omp_get_max_threads()), max(nf - 1, Index(1)));
+  const Index chunk =
+      f_chunk_size > 0 ? f_chunk_size : (nf - 1 + nthreads - 1) / nthreads;
+
+#pragma omp parallel if (!arts_omp_in_parallel() && nf > 2)
+  {
+    disort_verbosity = cdisort_verbosity;
+
+    disort_state ds;
+    disort_output out;
+    init_disort(ds, out);
+
+#pragma omp for schedule(dynamic, chunk)
+    for (Index f_index = 1; f_index < nf; f_index++)
+      run_frequency(ds, out, f_index);
+
+    /* Free allocated memory */
+    c_disort_out_free(&ds, &out);
+    c_disort_state_free(&ds);
+  }
 }
 
 void surf_albedoCalc(Workspace& ws,
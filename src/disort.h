@@ -27,11 +27,14 @@
 #ifndef disort_h
 #define disort_h
 
+#include <vector>
 #include "agenda_class.h"
 #include "matpackIV.h"
 #include "mystring.h"
 #include "optproperties.h"
 
+struct DisortPhaseCache;
+
 /** check_disort_input. *** FIXMEDOC *** in disort.cc, line 197
  *
  * Checks that input of DisortCalc* is sane.
@@ -142,6 +145,11 @@ void get_disortsurf_props(  // Output
  * @param[in]     Npfct Number of angular grid points to calculate bulk phase
  *                function
  * @param[in]     quiet Silence warnings
+ * @param[in]     f_chunk_size Number of frequencies handed to a thread at a
+ *                time. If <= 0, each thread gets one contiguous chunk
+ * @param[in,out] phase_cache Phase functions of scat_data, see
+ *                get_phase_cache. Kept by the caller, so that calls with
+ *                the same scat_data derive them only once.
  * @param[in]     verbosity Verbosity setting
  *
  * @author        Oliver Lemke
@@ -167,6 +175,8 @@ void run_cdisort(Workspace& ws,
                  const Index& nstreams,
                  const Index& Npfct,
                  const Index& quiet,
+                 const Index& f_chunk_size,
+                 DisortPhaseCache& phase_cache,
                  const Verbosity& verbosity);
 
 /** get_gasoptprop.
@@ -331,6 +341,100 @@ void get_pmom(Tensor3View pmom,
               ConstVectorView pfct_angs,
               const Index& Nlegendre);
 
+/** Phase functions and Legendre integrals of single scattering elements.
+ *
+ * get_parZ, get_pfct and get_pmom extract the phase function of every
+ * scattering element at the temperature of every layer and decompose the
+ * pnd-weighted bulk into Legendre moments. The angular part of that only
+ * depends on the scattering data. This holds it for all elements at their
+ * own frequency and temperature grids, so each layer only needs a
+ * temperature interpolation and a pnd-weighted sum.
+ */
+struct DisortPhaseCache {
+  /** The scattering data the cache was derived from, by identity. */
+  const ArrayOfArrayOfSingleScatteringData* scat_data{nullptr};
+  /** The phase matrix data of each element, by identity. */
+  std::vector<const Numeric*> pha_mat_data;
+  /** The sum of the phase matrix data of each element. */
+  std::vector<Numeric> pha_mat_sum;
+  /** Angular grid of the phase functions. */
+  Vector pfct_angs;
+  /** Number of Legendre moments. */
+  Index Nlegendre{0};
+  /** Phase function at pfct_angs[0], [flat element](ssd freq, ssd temp). */
+  ArrayOfMatrix pha0;
+  /** Legendre integrals, [flat element](ssd freq, ssd temp, moment). Moment
+   * 0 holds half the integral of the phase function over cos(angle). */
+  ArrayOfTensor3 legendre;
+};
+
+/** get_phase_cache
+ *
+ * Derives the phase functions and Legendre integrals of all scattering
+ * elements, unless the cache already holds them. The cache is keyed by
+ * the identity of scat_data and of the phase matrix data of its elements,
+ * and by pfct_angs and Nlegendre. The sum of the phase matrix data of
+ * each element is compared as well, to notice data that is replaced in
+ * place, as by a batch case that reads other scattering data into the
+ * same variable.
+ *
+ * @param[in,out] cache      The cache for this scat_data.
+ * @param[in]     scat_data  As the WSV.
+ * @param[in]     pfct_angs  See get_angs.
+ * @param[in]     Nlegendre  Number of Legendre moments to derive.
+ *
+ * @return True if the cache was derived anew, false if it was reused.
+ */
+bool get_phase_cache(DisortPhaseCache& cache,
+                     const ArrayOfArrayOfSingleScatteringData& scat_data,
+                     ConstVectorView pfct_angs,
+                     const Index& Nlegendre);
+
+/** Shares a phase cache between the DISORT calls of a batch.
+ *
+ * DOBatchCalc keeps one DisortPhaseCache per thread for the whole batch
+ * and opens a scope with it around each batch case. The DISORT methods
+ * that run in the case on the same thread then use that cache instead of
+ * their own, so that cases with the same scattering data reuse it.
+ */
+class DisortPhaseCacheScope {
+ public:
+  explicit DisortPhaseCacheScope(DisortPhaseCache& cache);
+  ~DisortPhaseCacheScope();
+
+  DisortPhaseCacheScope(const DisortPhaseCacheScope&) = delete;
+  DisortPhaseCacheScope& operator=(const DisortPhaseCacheScope&) = delete;
+
+  /** The cache of the innermost scope on this thread, else own_cache. */
+  static DisortPhaseCache& Current(DisortPhaseCache& own_cache);
+
+ private:
+  DisortPhaseCache* mprevious;
+};
+
+/** get_pmom_cached
+ *
+ * Calculates the same Legendre moments as get_parZ, get_pfct and get_pmom
+ * in sequence, but from the per-element integrals in cache.
+ *
+ * @param[out] pmom            Legendre moments for all layers.
+ * @param[in]  cache           See get_phase_cache.
+ * @param[in]  scat_data       As the WSV, the same as for cache.
+ * @param[in]  pnd_profiles    PND profiles.
+ * @param[in]  t_profile       Temperature profile.
+ * @param[in]  ext_bulk_par    See get_paroptprop.
+ * @param[in]  abs_bulk_par    See get_paroptprop.
+ * @param[in]  cloudbox_limits As the WSV.
+ */
+void get_pmom_cached(Tensor3View pmom,
+                     const DisortPhaseCache& cache,
+                     const ArrayOfArrayOfSingleScatteringData& scat_data,
+                     ConstMatrixView pnd_profiles,
+                     ConstVectorView t_profile,
+                     ConstMatrixView ext_bulk_par,
+                     ConstMatrixView abs_bulk_par,
+                     const ArrayOfIndex& cloudbox_limits);
+
 /** reduced_1datm
  *
  * Crops a 1D atmosphere, to create an atmosphere where the surface is placed
@@ -31,6 +31,7 @@
   ===========================================================================*/
 
 #include "doit.h"
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
@@ -1692,6 +1693,81 @@ void cloudbox_field_ngAcceleration(Tensor6& cloudbox_field_mono,
   }
 }
 
+void cloudbox_field_andersonAcceleration(Tensor6& cloudbox_field_mono,
+                                         ArrayOfVector& x_history,
+                                         ArrayOfVector& g_history,
+                                         const Tensor6& cloudbox_field_mono_old,
+                                         const Index& accelerated,
+                                         const Index& memory,
+                                         const Verbosity&) {
+  const Index N_stokes = cloudbox_field_mono.ncols();
+  const Index N_acc = std::min(accelerated, N_stokes);
+  const Index N_dir = cloudbox_field_mono.nvitrines() *
+                      cloudbox_field_mono.nshelves() *
+                      cloudbox_field_mono.nbooks() *
+                      cloudbox_field_mono.npages() *
+                      cloudbox_field_mono.nrows();
+
+  // Only the accelerated Stokes components enter the least-squares problem
+  Vector x(N_dir * N_acc), g(N_dir * N_acc);
+  const Numeric* x_data = cloudbox_field_mono_old.get_c_array();
+  Numeric* g_data = cloudbox_field_mono.get_c_array();
+  for (Index k = 0; k < N_dir; k++) {
+    for (Index i = 0; i < N_acc; i++) {
+      x[k * N_acc + i] = x_data[k * N_stokes + i];
+      g[k * N_acc + i] = g_data[k * N_stokes + i];
+    }
+  }
+
+  x_history.push_back(x);
+  g_history.push_back(g);
+  if (x_history.nelem() > memory + 1) {
+    x_history.erase(x_history.begin());
+    g_history.erase(g_history.begin());
+  }
+
+  const Index m = x_history.nelem() - 1;
+  if (m == 0) return;
+
+  // Differences of the residuals f = g - x and of the outputs g of
+  // consecutive iteration steps
+  Vector f = g;
+  f -= x;
+  ArrayOfVector delta_f(m), delta_g(m);
+  for (Index j = 0; j < m; j++) {
+    delta_g[j] = g_history[j + 1];
+    delta_g[j] -= g_history[j];
+    delta_f[j] = delta_g[j];
+    delta_f[j] -= x_history[j + 1];
+    delta_f[j] += x_history[j];
+  }
+
+  // Normal equations of min |f - delta_f gamma|, slightly regularized to
+  // handle nearly linearly dependent steps
+  Matrix A(m, m);
+  Vector b(m);
+  Numeric trace = 0;
+  for (Index j = 0; j < m; j++) {
+    for (Index l = 0; l <= j; l++) A(j, l) = A(l, j) = delta_f[j] * delta_f[l];
+    b[j] = delta_f[j] * f;
+    trace += A(j, j);
+  }
+  if (!(trace > 0)) return;
+  for (Index j = 0; j < m; j++) A(j, j) += 1e-12 * trace;
+
+  Vector gamma(m);
+  solve(gamma, A, b);
+  for (Index j = 0; j < m; j++)
+    if (std::isnan(gamma[j])) return;
+
+  for (Index j = 0; j < m; j++) {
+    const Numeric* dg = delta_g[j].get_c_array();
+    for (Index k = 0; k < N_dir; k++)
+      for (Index i = 0; i < N_acc; i++)
+        g_data[k * N_stokes + i] -= gamma[j] * dg[k * N_acc + i];
+  }
+}
+
 void interp_cloud_coeff1D(  //Output
     Tensor3View ext_mat_int,
     MatrixView abs_vec_int,
@@ -532,6 +532,40 @@ void cloudbox_field_ngAcceleration(  //Output
     const Index& accelerated,
     const Verbosity& verbosity);
 
+//! Anderson convergence acceleration
+/*!
+ This function accelerates the convergence of the doit iteration by treating
+ one iteration step as a fixed-point map G and replacing the new field by the
+ combination of the last iteration steps that minimizes the residual
+ G(x) - x in a least-squares sense (Walker and Ni, 2011). As one iteration
+ step is affine in the field, this is equivalent to GMRES applied to the
+ source iteration when the whole history is kept.
+
+ The history is extended by the last iteration step, and the oldest step is
+ dropped when more than memory + 1 steps are stored.
+
+ \param[in,out] cloudbox_field_mono Radiation field after the last iteration
+                step. Returns the accelerated field
+ \param[in,out] x_history Flattened fields that entered the previous
+                iteration steps
+ \param[in,out] g_history Flattened fields that came out of the previous
+                iteration steps
+ \param[in]     cloudbox_field_mono_old Radiation field that entered the last
+                iteration step
+ \param[in]     accelerated Number of Stokes components to accelerate
+ \param[in]     memory Maximum number of previous iteration steps combined
+ \param[in]     verbosity Verbosity setting
+*/
+void cloudbox_field_andersonAcceleration(  //Output
+    Tensor6& cloudbox_field_mono,
+    ArrayOfVector& x_history,
+    ArrayOfVector& g_history,
+    //Input
+    const Tensor6& cloudbox_field_mono_old,
+    const Index& accelerated,
+    const Index& memory,
+    const Verbosity& verbosity);
+
 //! Interpolate all inputs of the VRTE on a propagation path step
 /*!
   Used in the WSM cloud_ppath_update1D.
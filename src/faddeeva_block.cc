@@ -0,0 +1,173 @@
+/* Copyright (C) 2026
+ * agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+ * USA. */
+
+/*!
+ * @file   faddeeva_block.cc
+ * @author agent <agent@local>
+ * @date   2026-10-17
+ *
+ * @brief  Block-wise evaluation of the Faddeeva function.
+ *
+ * The approximate tiers follow J.A.C. Weideman, Computation of the Complex
+ * Error Function, SIAM J. Numer. Anal. 31 (1994) 1497-1518
+ */
+
+#include "faddeeva_block.h"
+#include <Faddeeva/Faddeeva.hh>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include "constants.h"
+
+namespace FaddeevaBlock {
+
+/** Weideman's rational approximation coefficients
+ *
+ * Holds the scale L and the polynomial coefficients a_n (n=1..N) of
+ *
+ * w(z) ~ 2 p(Z) / (L - iz)^2 + 1 / (sqrt(pi) (L - iz)),
+ *
+ * with Z = (L + iz) / (L - iz) and p(Z) = sum a_n Z^(n-1)
+ */
+template <Index N>
+struct WeidemanCoefficients {
+  Numeric L;
+  std::array<Numeric, N> a;
+
+  WeidemanCoefficients() noexcept : L(std::sqrt(N / Constant::sqrt_2)), a() {
+    // The Fourier coefficients of f(t) = exp(-t^2) (L^2 + t^2) in theta,
+    // where t = L tan(theta / 2), using the trapezoidal rule on 2M points
+    constexpr Index M = 2 * N;
+    for (Index n = 1; n <= N; n++) {
+      Numeric s = 0;
+      for (Index k = -M + 1; k < M; k++) {
+        const Numeric t = L * std::tan(0.5 * Numeric(k) * Constant::pi / Numeric(M));
+        s += std::exp(-t * t) * (L * L + t * t) *
+             std::cos(Constant::pi * Numeric(n) * Numeric(k) / Numeric(M));
+      }
+      a[n - 1] = s / (2 * M);
+    }
+  }
+};
+
+template <Index N>
+const WeidemanCoefficients<N>& weideman_coefficients() noexcept {
+  static const WeidemanCoefficients<N> coefs;
+  return coefs;
+}
+
+/** Weideman approximation of w(z) over a block
+ *
+ * The complex arithmetic is written out in real and imaginary parts so that
+ * the loop has no calls and no branches and can be vectorized.  Lower
+ * half-plane arguments are evaluated at -z and fixed afterwards
+ *
+ * @param[out] W The Faddeeva function as interleaved real and imaginary parts
+ * @param[in]  z The arguments as interleaved real and imaginary parts
+ * @param[in]  n The number of elements
+ */
+template <Index N>
+void weideman(Numeric* W, const Numeric* z, const Index n) noexcept {
+  const auto& coefs = weideman_coefficients<N>();
+  const Numeric L = coefs.L;
+  const Numeric L2 = L * L;
+  const Numeric* a = coefs.a.data();
+
+  bool any_lower = false;
+
+#pragma omp simd reduction(|| : any_lower)
+  for (Index i = 0; i < n; i++) {
+    const Numeric y0 = z[2 * i + 1];
+    const bool lower = y0 < 0;
+    const Numeric x = lower ? -z[2 * i] : z[2 * i];
+    const Numeric y = lower ? -y0 : y0;
+    any_lower = any_lower || lower;
+
+    // r = 1 / (L - iz) and Z = (L + iz) / (L - iz)
+    const Numeric inv_d2 = 1 / ((L + y) * (L + y) + x * x);
+    const Numeric rr = (L + y) * inv_d2;
+    const Numeric ri = x * inv_d2;
+    const Numeric Zr = (L2 - x * x - y * y) * inv_d2;
+    const Numeric Zi = 2 * L * x * inv_d2;
+
+    // p = sum a_n Z^(n-1) by Horner's scheme
+    Numeric pr = a[N - 1], pm = 0;
+    for (Index k = N - 2; k >= 0; k--) {
+      const Numeric tr = pr * Zr - pm * Zi + a[k];
+      pm = pr * Zi + pm * Zr;
+      pr = tr;
+    }
+
+    // w = 2 p r^2 + r / sqrt(pi)
+    const Numeric r2r = rr * rr - ri * ri;
+    const Numeric r2i = 2 * rr * ri;
+    W[2 * i] = 2 * (pr * r2r - pm * r2i) + Constant::inv_sqrt_pi * rr;
+    W[2 * i + 1] = 2 * (pr * r2i + pm * r2r) + Constant::inv_sqrt_pi * ri;
+  }
+
+  // Reflect lower half-plane values, w(z) = 2 exp(-z^2) - w(-z)
+  if (any_lower) {
+    for (Index i = 0; i < n; i++) {
+      if (z[2 * i + 1] < 0) {
+        const Complex zi(z[2 * i], z[2 * i + 1]);
+        const Complex wi =
+            2.0 * std::exp(-zi * zi) - Complex(W[2 * i], W[2 * i + 1]);
+        W[2 * i] = wi.real();
+        W[2 * i + 1] = wi.imag();
+      }
+    }
+  }
+}
+
+/** Chunk size of the approximate tiers
+ *
+ * The arguments are copied chunk-wise to the stack so that W and z may share
+ * memory even though the lower half-plane fix needs the original z
+ */
+constexpr Index chunk_size = 64;
+
+template <Index N>
+void weideman_chunked(Eigen::Ref<Eigen::VectorXcd> W,
+                      const Eigen::Ref<const Eigen::VectorXcd> z) noexcept {
+  std::array<Numeric, 2 * chunk_size> zc;
+  for (Index i0 = 0; i0 < z.size(); i0 += chunk_size) {
+    const Index nc = std::min(chunk_size, z.size() - i0);
+    for (Index i = 0; i < nc; i++) {
+      zc[2 * i] = z[i0 + i].real();
+      zc[2 * i + 1] = z[i0 + i].imag();
+    }
+    weideman<N>(reinterpret_cast<Numeric*>(W.data() + i0), zc.data(), nc);
+  }
+}
+
+void w(Eigen::Ref<Eigen::VectorXcd> W,
+       const Eigen::Ref<const Eigen::VectorXcd> z,
+       const Accuracy accuracy) noexcept {
+  switch (accuracy) {
+    case Accuracy::Exact:
+      for (Index i = 0; i < z.size(); i++) W[i] = Faddeeva::w(z[i]);
+      break;
+    case Accuracy::High:
+      weideman_chunked<32>(W, z);
+      break;
+    case Accuracy::Fast:
+      weideman_chunked<16>(W, z);
+      break;
+  }
+}
+}  // FaddeevaBlock
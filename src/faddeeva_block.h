@@ -0,0 +1,96 @@
+/* Copyright (C) 2026
+ * agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+ * USA. */
+
+/*!
+ * @file   faddeeva_block.h
+ * @author agent <agent@local>
+ * @date   2026-10-17
+ *
+ * @brief  Block-wise evaluation of the Faddeeva function.
+ *
+ * The line shapes evaluate w(z) for a full block of frequencies at a time.
+ * Doing so one element at a time through Faddeeva::w prevents the compiler
+ * from using vector lanes, so this file offers a block evaluator that can
+ * either call the reference implementation or use Weideman's rational
+ * approximation in a branch-free loop that vectorizes over the block
+ */
+
+#ifndef faddeeva_block_h
+#define faddeeva_block_h
+
+#include <Eigen/Core>
+#include "complex.h"
+#include "mystring.h"
+
+/** Block-wise Faddeeva function evaluation */
+namespace FaddeevaBlock {
+
+/** Accuracy tier of the evaluation
+ *
+ * Exact calls Faddeeva::w for every element
+ *
+ * High uses Weideman's N=32 rational approximation, relative error
+ * below ~1e-12 in the upper half-plane
+ *
+ * Fast uses Weideman's N=16 rational approximation, relative error
+ * below ~1e-6 in the upper half-plane
+ */
+enum class Accuracy : Index {
+  Exact,
+  High,
+  Fast,
+};  // Accuracy
+
+inline Accuracy string2accuracy(const String& in) {
+  if (in == "Exact")
+    return Accuracy::Exact;
+  else if (in == "High")
+    return Accuracy::High;
+  else if (in == "Fast")
+    return Accuracy::Fast;
+  else
+    throw std::runtime_error("Cannot recognize the Faddeeva accuracy type");
+}
+
+inline String accuracy2string(Accuracy in) {
+  if (in == Accuracy::Exact)
+    return "Exact";
+  else if (in == Accuracy::High)
+    return "High";
+  else if (in == Accuracy::Fast)
+    return "Fast";
+  std::terminate();
+}
+
+/** Sets W = w(z) for a full block
+ *
+ * Elements of z in the lower half-plane are evaluated through the
+ * reflection w(z) = 2 exp(-z^2) - w(-z) for the approximate tiers
+ *
+ * W and z may be the same memory
+ *
+ * @param[out] W The Faddeeva function.  Must be right size
+ * @param[in]  z The arguments
+ * @param[in]  accuracy The accuracy tier of the computations
+ */
+void w(Eigen::Ref<Eigen::VectorXcd> W,
+       const Eigen::Ref<const Eigen::VectorXcd> z,
+       const Accuracy accuracy) noexcept;
+}  // FaddeevaBlock
+
+#endif  // faddeeva_block_h
@@ -24,14 +24,897 @@
 */
 
 #include "gas_abs_lookup.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <cfloat>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include "arts_omp.h"
 #include "check_input.h"
+#include "file.h"
 #include "interpolation.h"
 #include "interpolation_poly.h"
 #include "logic.h"
 #include "messages.h"
 #include "physics_funcs.h"
+#include "xml_io.h"
+
+//! Header of the packed cross section format.
+/*!
+  The header is followed by the cross sections in the order of
+  GasAbsLookup::xsec, starting at data_offset. The element size gives
+  the storage, 8 for doubles, 4 for floats and 2 for quantized cross
+  sections. Quantized cross sections have one block of two floats, the
+  offset and the step of the logarithm, for each pressure profile,
+  starting at block_offset. The byte order mark catches files written
+  on a machine of other endianness. */
+struct LookupXsecHeader {
+  char magic[8];
+  std::int64_t byte_order;
+  std::int64_t element_size;
+  std::int64_t data_offset;
+  std::int64_t dims[4];
+  std::int64_t block_offset;
+};
+
+//! Identifies packed cross section files.
+constexpr char lookup_xsec_magic[8] = {'A', 'R', 'T', 'S', 'L', 'U', 'T', '1'};
+
+//! Byte order mark of packed cross section files.
+constexpr std::int64_t lookup_xsec_byte_order = 0x0102030405060708;
+
+//! Alignment of the sections of packed cross section files.
+/*! One page, so that memory mapped data is page aligned. */
+constexpr std::int64_t lookup_xsec_page = 4096;
+
+//! Largest magnitude code of quantized cross sections.
+constexpr std::uint16_t lookup_xsec_max_code = 0x7FFF;
+
+//! Sign bit of quantized cross sections.
+/*! Together with a zero magnitude it marks NaN. */
+constexpr std::uint16_t lookup_xsec_sign = 0x8000;
+
+//! Decode a quantized cross section.
+/*!
+  \param code The quantized cross section.
+  \param block Offset and step of the logarithm of its profile.
+
+  \return The cross section.
+*/
+inline Numeric lookup_dequantize(const std::uint16_t code,
+                                 const float* block) {
+  const Index m = code & lookup_xsec_max_code;
+  if (m == 0) return (code & lookup_xsec_sign) ? NAN : 0;
+  const Numeric x = std::exp(Numeric(block[0]) + Numeric(m - 1) * block[1]);
+  return (code & lookup_xsec_sign) ? -x : x;
+}
+
+//! Quantize a pressure profile of cross sections.
+/*!
+  The logarithms of the absolute values are quantized with a step that
+  spans the range of the profile with lookup_xsec_max_code codes. Zero
+  and NaN have codes of their own.
+
+  \param[out] code The quantized cross sections. Dimension: [x.nelem()].
+  \param[out] block Offset and step of the logarithm. Dimension: [2].
+  \param[in]  x The cross sections.
+*/
+void lookup_quantize(std::uint16_t* code, float* block, ConstVectorView x) {
+  Numeric lmin = INFINITY, lmax = -INFINITY;
+  for (Index i = 0; i < x.nelem(); i++) {
+    if (x[i] == 0 or not std::isfinite(x[i])) continue;
+    const Numeric l = std::log(std::abs(x[i]));
+    lmin = std::min(lmin, l);
+    lmax = std::max(lmax, l);
+  }
+
+  block[0] = lmin <= lmax ? float(lmin) : 0;
+  block[1] = lmin < lmax ? float((lmax - lmin) / (lookup_xsec_max_code - 1)) : 0;
+
+  for (Index i = 0; i < x.nelem(); i++) {
+    if (std::isnan(x[i])) {
+      code[i] = lookup_xsec_sign;
+    } else if (x[i] == 0) {
+      code[i] = 0;
+    } else {
+      const Numeric l = std::log(std::abs(x[i]));
+      const Numeric m =
+          block[1] > 0 ? std::round((l - block[0]) / block[1]) : 0;
+      code[i] = std::uint16_t(
+          1 + std::min(std::max(m, 0.), Numeric(lookup_xsec_max_code - 1)));
+      if (x[i] < 0) code[i] |= lookup_xsec_sign;
+    }
+  }
+}
+
+//! Size in bytes of one cross section of a storage type.
+Index lookup_xsec_element_size(const LookupStorage storage) {
+  switch (storage) {
+    case LookupStorage::Double:
+      return sizeof(Numeric);
+    case LookupStorage::Float:
+      return sizeof(float);
+    case LookupStorage::Quantized:
+      return sizeof(std::uint16_t);
+  }
+  std::terminate();
+}
+
+//! Rounds up to a full page.
+Index lookup_xsec_page_align(const Index n) {
+  return ((n + lookup_xsec_page - 1) / lookup_xsec_page) * lookup_xsec_page;
+}
+
+//! Header of packed cross sections of a given size and storage.
+LookupXsecHeader lookup_xsec_header(
+    Index b, Index p, Index r, Index c, const LookupStorage storage) {
+  LookupXsecHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, lookup_xsec_magic, 8);
+  header.byte_order = lookup_xsec_byte_order;
+  header.element_size = lookup_xsec_element_size(storage);
+  header.dims[0] = b;
+  header.dims[1] = p;
+  header.dims[2] = r;
+  header.dims[3] = c;
+  if (storage == LookupStorage::Quantized) {
+    header.block_offset = lookup_xsec_page;
+    header.data_offset = lookup_xsec_page +
+                         lookup_xsec_page_align(b * p * r * 2 * sizeof(float));
+  } else {
+    header.data_offset = lookup_xsec_page;
+  }
+  return header;
+}
+
+//! Size in bytes of packed cross sections with a given header.
+Index lookup_xsec_image_size(const LookupXsecHeader& header) {
+  return header.data_offset + header.dims[0] * header.dims[1] *
+                                  header.dims[2] * header.dims[3] *
+                                  header.element_size;
+}
+
+//! Writes packed cross sections to a buffer that is sized beforehand.
+/*!
+  Has the write of std::ostream, so that the image of packed cross
+  sections is built in place instead of in a stream and then copied.
+*/
+class LookupXsecBuffer {
+ public:
+  explicit LookupXsecBuffer(std::string& image)
+      : mpos(&image[0]), mend(mpos + image.size()) {}
+
+  void write(const char* s, const std::streamsize n) {
+    assert(mend - mpos >= n);
+    std::memcpy(mpos, s, n);
+    mpos += n;
+  }
+
+ private:
+  char* mpos;
+  const char* mend;
+};
+
+//! Writes the header page of packed cross sections.
+template <class Output>
+void lookup_xsec_write_header(Output& os, const LookupXsecHeader& header) {
+  std::vector<char> head(lookup_xsec_page, 0);
+  std::memcpy(head.data(), &header, sizeof(header));
+  os.write(head.data(), head.size());
+}
+
+//! Writes zeros up to the data of packed cross sections.
+/*!
+  \param os The stream or buffer.
+  \param header The header of the cross sections.
+  \param nblocks The number of blocks that have been written.
+*/
+template <class Output>
+void lookup_xsec_write_padding(Output& os,
+                               const LookupXsecHeader& header,
+                               const Index nblocks) {
+  if (not header.block_offset) return;
+  const Index n =
+      header.data_offset - header.block_offset - nblocks * 2 * sizeof(float);
+  const std::vector<char> zeros(n, 0);
+  os.write(zeros.data(), zeros.size());
+}
+
+//! Writes cross sections in the packed format.
+/*!
+  \param os The stream or buffer.
+  \param x The cross sections, dimensions as GasAbsLookup::xsec.
+  \param storage The storage type.
+*/
+template <class Output>
+void lookup_xsec_write(Output& os,
+                       ConstTensor4View x,
+                       const LookupStorage storage) {
+  const LookupXsecHeader header = lookup_xsec_header(
+      x.nbooks(), x.npages(), x.nrows(), x.ncols(), storage);
+  lookup_xsec_write_header(os, header);
+
+  const Index n = x.ncols();
+  std::vector<Numeric> d(storage == LookupStorage::Double ? n : 0);
+  std::vector<float> f(storage == LookupStorage::Float ? n : 0);
+  std::vector<std::uint16_t> q(storage == LookupStorage::Quantized ? n : 0);
+  float block[2];
+
+  // The blocks of quantized cross sections come first, so the
+  // profiles are quantized twice
+  if (storage == LookupStorage::Quantized) {
+    for (Index b = 0; b < x.nbooks(); b++)
+      for (Index p = 0; p < x.npages(); p++)
+        for (Index r = 0; r < x.nrows(); r++) {
+          lookup_quantize(q.data(), block, x(b, p, r, joker));
+          os.write(reinterpret_cast<const char*>(block), sizeof(block));
+        }
+    lookup_xsec_write_padding(os, header, x.nbooks() * x.npages() * x.nrows());
+  }
+
+  for (Index b = 0; b < x.nbooks(); b++)
+    for (Index p = 0; p < x.npages(); p++)
+      for (Index r = 0; r < x.nrows(); r++) {
+        switch (storage) {
+          case LookupStorage::Double:
+            for (Index c = 0; c < n; c++) d[c] = x(b, p, r, c);
+            os.write(reinterpret_cast<const char*>(d.data()),
+                     n * sizeof(Numeric));
+            break;
+          case LookupStorage::Float:
+            for (Index c = 0; c < n; c++) f[c] = float(x(b, p, r, c));
+            os.write(reinterpret_cast<const char*>(f.data()),
+                     n * sizeof(float));
+            break;
+          case LookupStorage::Quantized:
+            lookup_quantize(q.data(), block, x(b, p, r, joker));
+            os.write(reinterpret_cast<const char*>(q.data()),
+                     n * sizeof(std::uint16_t));
+            break;
+        }
+      }
+}
+
+//! Packs cross sections into an image in memory.
+/*!
+  The image is allocated once with its final size and written in place.
+
+  \param x The cross sections, dimensions as GasAbsLookup::xsec.
+  \param storage The storage type.
+
+  \return The image of the packed cross sections.
+*/
+std::string lookup_xsec_image(ConstTensor4View x, const LookupStorage storage) {
+  std::string image(lookup_xsec_image_size(lookup_xsec_header(
+                        x.nbooks(), x.npages(), x.nrows(), x.ncols(), storage)),
+                    '\0');
+  LookupXsecBuffer buffer(image);
+  lookup_xsec_write(buffer, x, storage);
+  return image;
+}
+
+//! A Tensor4 view of memory that is not owned by a Tensor4.
+class ExternalTensor4View : public ConstTensor4View {
+ public:
+  ExternalTensor4View(const Numeric* data, Index b, Index p, Index r, Index c)
+      : ConstTensor4View(const_cast<Numeric*>(data),
+                         Range(0, b, p * r * c),
+                         Range(0, p, r * c),
+                         Range(0, r, c),
+                         Range(0, c)) {}
+};
+
+//! Packed absorption cross sections.
+/*!
+  The cross sections in the packed format, either as a read-only memory
+  map of a cross section file or as an image in memory. The file is
+  mapped shared, so the operating system loads pages on first access
+  and keeps one physical copy for all processes that map the same
+  file. */
+class LookupXsecStore {
+ public:
+  //! Memory map a cross section file.
+  explicit LookupXsecStore(const String& filename) {
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+      ostringstream os;
+      os << "Cannot open lookup table cross section file " << filename;
+      throw runtime_error(os.str());
+    }
+
+    struct stat st;
+    LookupXsecHeader header;
+    if (fstat(fd, &st) not_eq 0 or
+        st.st_size < Index(sizeof(LookupXsecHeader)) or
+        pread(fd, &header, sizeof(header), 0) not_eq
+            ssize_t(sizeof(header))) {
+      close(fd);
+      ostringstream os;
+      os << "Lookup table cross section file " << filename
+         << " is too small";
+      throw runtime_error(os.str());
+    }
+
+    // Nothing is mapped for a header that does not fit the file
+    try {
+      CheckHeader(header, Index(st.st_size), filename);
+    } catch (const std::runtime_error&) {
+      close(fd);
+      throw;
+    }
+
+    msize = size_t(st.st_size);
+    void* addr = mmap(nullptr, msize, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+      ostringstream os;
+      os << "Cannot memory map lookup table cross section file " << filename;
+      throw runtime_error(os.str());
+    }
+    maddr = addr;
+    mbase = static_cast<const char*>(maddr);
+
+    try {
+      Init(filename);
+    } catch (const std::runtime_error&) {
+      munmap(maddr, msize);
+      throw;
+    }
+  }
+
+  //! Keep a packed image in memory.
+  explicit LookupXsecStore(std::string&& image) : mimage(std::move(image)) {
+    msize = mimage.size();
+    mbase = mimage.data();
+    Init("in memory");
+  }
+
+  //! Keep in-memory Double cross sections.
+  explicit LookupXsecStore(Tensor4&& x) : mtensor(std::move(x)) {
+    mstorage = LookupStorage::Double;
+    mdims[0] = mtensor.nbooks();
+    mdims[1] = mtensor.npages();
+    mdims[2] = mtensor.nrows();
+    mdims[3] = mtensor.ncols();
+    mdata = reinterpret_cast<const char*>(mtensor.get_c_array());
+  }
+
+  LookupXsecStore(const LookupXsecStore&) = delete;
+  LookupXsecStore& operator=(const LookupXsecStore&) = delete;
+
+  ~LookupXsecStore() {
+    if (maddr) munmap(maddr, msize);
+  }
+
+  //! Whether the cross sections are memory mapped.
+  bool IsMapped() const { return maddr != nullptr; }
+
+  //! The storage type.
+  LookupStorage Storage() const { return mstorage; }
+
+  //! The packed image, as in a cross section file.
+  /*! Null for in-memory Double cross sections. */
+  const char* Image() const { return mbase; }
+
+  //! The size of Image in bytes.
+  size_t ImageSize() const { return msize; }
+
+  Index nbooks() const { return mdims[0]; }
+  Index npages() const { return mdims[1]; }
+  Index nrows() const { return mdims[2]; }
+  Index ncols() const { return mdims[3]; }
+
+  //! The cross sections, or codes, without header and blocks.
+  const char* Data() const { return mdata; }
+
+  //! The cross sections of Double storage.
+  ConstTensor4View View() const {
+    assert(mstorage == LookupStorage::Double);
+    return ExternalTensor4View(reinterpret_cast<const Numeric*>(mdata),
+                               mdims[0],
+                               mdims[1],
+                               mdims[2],
+                               mdims[3]);
+  }
+
+  //! The cross sections of Float storage.
+  const float* Floats() const { return reinterpret_cast<const float*>(mdata); }
+
+  //! The codes of Quantized storage.
+  const std::uint16_t* Codes() const {
+    return reinterpret_cast<const std::uint16_t*>(mdata);
+  }
+
+  //! The blocks of Quantized storage, two per pressure profile.
+  const float* Blocks() const { return mblocks; }
+
+  //! Index of a pressure profile, the block of Quantized storage.
+  Index Row(Index b, Index p, Index r) const {
+    return (b * mdims[1] + p) * mdims[2] + r;
+  }
+
+  //! Offset of a cross section in the data.
+  Index Offset(Index b, Index p, Index r, Index c) const {
+    return Row(b, p, r) * mdims[3] + c;
+  }
+
+  //! A single cross section.
+  Numeric Value(Index b, Index p, Index r, Index c) const {
+    switch (mstorage) {
+      case LookupStorage::Double:
+        return reinterpret_cast<const Numeric*>(mdata)[Offset(b, p, r, c)];
+      case LookupStorage::Float:
+        return Floats()[Offset(b, p, r, c)];
+      case LookupStorage::Quantized:
+        return lookup_dequantize(Codes()[Offset(b, p, r, c)],
+                                 mblocks + 2 * Row(b, p, r));
+    }
+    std::terminate();
+  }
+
+ private:
+  //! Product of dimensions, or -1 if one is negative or it exceeds limit.
+  static Index DimsProduct(const std::int64_t* dims,
+                           const Index ndims,
+                           const Index limit) {
+    Index n = 1;
+    for (Index i = 0; i < ndims; i++) {
+      if (dims[i] < 0) return -1;
+      if (dims[i] == 0) n = 0;
+    }
+    // Divisions instead of products, so that no product can overflow
+    for (Index i = 0; n and i < ndims; i++) {
+      if (n > limit / dims[i]) return -1;
+      n *= dims[i];
+    }
+    return n;
+  }
+
+  //! Validates a header against the size of its image.
+  /*!
+    \param header The header.
+    \param size The size of the image in bytes.
+    \param name The file name, for the error message.
+
+    \return The storage type.
+  */
+  static LookupStorage CheckHeader(const LookupXsecHeader& header,
+                                   const Index size,
+                                   const String& name) {
+    LookupStorage storage = LookupStorage::Double;
+    bool ok = std::memcmp(header.magic, lookup_xsec_magic, 8) == 0 and
+              header.byte_order == lookup_xsec_byte_order and
+              header.data_offset >= Index(sizeof(header)) and
+              header.data_offset <= size;
+    if (ok and header.element_size == Index(sizeof(Numeric))) {
+      storage = LookupStorage::Double;
+    } else if (ok and header.element_size == Index(sizeof(float))) {
+      storage = LookupStorage::Float;
+    } else if (ok and header.element_size == Index(sizeof(std::uint16_t))) {
+      storage = LookupStorage::Quantized;
+      ok = header.block_offset >= Index(sizeof(header)) and
+           header.block_offset <= header.data_offset and
+           DimsProduct(header.dims,
+                       3,
+                       (header.data_offset - header.block_offset) /
+                           Index(2 * sizeof(float))) >= 0;
+    } else {
+      ok = false;
+    }
+    ok = ok and DimsProduct(header.dims,
+                            4,
+                            (size - header.data_offset) /
+                                header.element_size) >= 0;
+
+    if (not ok) {
+      ostringstream os;
+      os << "Lookup table cross section file " << name
+         << " is broken or was written on another type of machine";
+      throw runtime_error(os.str());
+    }
+    return storage;
+  }
+
+  //! Validates the header and sets the data pointers.
+  void Init(const String& name) {
+    LookupXsecHeader header;
+    std::memcpy(&header, mbase, sizeof(header));
+    mstorage = CheckHeader(header, Index(msize), name);
+
+    for (Index i = 0; i < 4; i++) mdims[i] = header.dims[i];
+    mdata = mbase + header.data_offset;
+    mblocks = mstorage == LookupStorage::Quantized
+                  ? reinterpret_cast<const float*>(mbase + header.block_offset)
+                  : nullptr;
+  }
+
+  std::string mimage;
+  Tensor4 mtensor;
+  void* maddr{nullptr};
+  size_t msize{0};
+  const char* mbase{nullptr};
+  LookupStorage mstorage{LookupStorage::Double};
+  Index mdims[4]{0, 0, 0, 0};
+  const char* mdata{nullptr};
+  const float* mblocks{nullptr};
+};
+
+//! Selects pressure profiles of packed cross sections.
+/*!
+  The profiles are copied as they are, so that no error is added to
+  cross sections in Float or Quantized storage.
+
+  \param store The packed cross sections.
+  \param pages The page of store for each new page, -1 for NaN pages.
+  \param rows The row of store for each new row.
+
+  \return The image of the selected cross sections.
+*/
+std::string lookup_xsec_select(const LookupXsecStore& store,
+                               const ArrayOfIndex& pages,
+                               const ArrayOfIndex& rows) {
+  const LookupStorage storage = store.Storage();
+  const Index nb = store.nbooks(), np = pages.nelem(), nr = rows.nelem();
+  const Index nc = store.ncols();
+  const Index bytes = nc * lookup_xsec_element_size(storage);
+
+  const LookupXsecHeader header = lookup_xsec_header(nb, np, nr, nc, storage);
+  std::string image(lookup_xsec_image_size(header), '\0');
+  LookupXsecBuffer os(image);
+  lookup_xsec_write_header(os, header);
+
+  if (storage == LookupStorage::Quantized) {
+    const float nan_block[2] = {0, 0};
+    for (Index b = 0; b < nb; b++)
+      for (Index p = 0; p < np; p++)
+        for (Index r = 0; r < nr; r++) {
+          const float* block =
+              pages[p] < 0 ? nan_block
+                           : store.Blocks() + 2 * store.Row(b, pages[p], rows[r]);
+          os.write(reinterpret_cast<const char*>(block), 2 * sizeof(float));
+        }
+    lookup_xsec_write_padding(os, header, nb * np * nr);
+  }
+
+  std::vector<char> nan_row(bytes);
+  for (Index c = 0; c < nc; c++) {
+    if (storage == LookupStorage::Float)
+      reinterpret_cast<float*>(nan_row.data())[c] = NAN;
+    else if (storage == LookupStorage::Quantized)
+      reinterpret_cast<std::uint16_t*>(nan_row.data())[c] = lookup_xsec_sign;
+    else
+      reinterpret_cast<Numeric*>(nan_row.data())[c] = NAN;
+  }
+
+  const char* data = store.Data();
+  for (Index b = 0; b < nb; b++)
+    for (Index p = 0; p < np; p++)
+      for (Index r = 0; r < nr; r++) {
+        if (pages[p] < 0)
+          os.write(nan_row.data(), bytes);
+        else
+          os.write(data + store.Row(b, pages[p], rows[r]) * bytes, bytes);
+      }
+
+  return image;
+}
+
+//! A frequency column of cross sections in Float storage.
+struct LookupFloatColumn {
+  LookupFloatColumn(const LookupXsecStore& store, Index b, Index p, Index c)
+      : x(store.Floats() + store.Offset(b, p, 0, c)), stride(store.ncols()) {}
+
+  Numeric operator[](Index r) const { return x[r * stride]; }
+
+  const float* x;
+  Index stride;
+};
+
+//! A frequency column of cross sections in Quantized storage.
+struct LookupQuantizedColumn {
+  LookupQuantizedColumn(const LookupXsecStore& store,
+                        Index b,
+                        Index p,
+                        Index c)
+      : x(store.Codes() + store.Offset(b, p, 0, c)),
+        blocks(store.Blocks() + 2 * store.Row(b, p, 0)),
+        stride(store.ncols()) {}
+
+  Numeric operator[](Index r) const {
+    return lookup_dequantize(x[r * stride], blocks + 2 * r);
+  }
+
+  const std::uint16_t* x;
+  const float* blocks;
+  Index stride;
+};
+
+//! Adds frequency interpolated cross sections.
+/*!
+  \param[in,out] res The sum. Dimension: [new_f_grid].
+  \param[in] w The weight of the column.
+  \param[in] x A frequency column of cross sections.
+  \param[in] f_idx As from GasAbsLookup::ExtractFrequencyWeights.
+  \param[in] f_w As from GasAbsLookup::ExtractFrequencyWeights.
+*/
+template <typename Column>
+void lookup_add_column(VectorView res,
+                       const Numeric w,
+                       const Column& x,
+                       const ArrayOfIndex& f_idx,
+                       ConstMatrixView f_w) {
+  const Index n_f_interp = f_w.ncols();
+  for (Index i = 0; i < res.nelem(); ++i) {
+    Numeric s = 0;
+    for (Index k = 0; k < n_f_interp; ++k)
+      s += f_w(i, k) * x[f_idx[i * n_f_interp + k]];
+    res[i] += w * s;
+  }
+}
+
+//! The absorption cross sections of the table.
+/*!
+  These are either the in-memory xsec or the cross sections of the
+  store. Empty unless the storage is Double. For an adapted view, the
+  index maps XsecPage and XsecRow apply.
+
+  \return A view of the cross sections.
+*/
+ConstTensor4View GasAbsLookup::XsecData() const {
+  if (xsec_store and xsec_store->Storage() == LookupStorage::Double)
+    return xsec_store->View();
+  return xsec;
+}
+
+//! Page of the cross sections for a species page of the table.
+/*!
+  \param p The species, or nonlinear perturbation, page of the table.
+
+  \return The page in XsecData or in the store, -1 for trivial species.
+*/
+Index GasAbsLookup::XsecPage(const Index p) const {
+  return xsec_pages.empty() ? p : xsec_pages[p];
+}
+
+//! Row of the cross sections for a frequency of the table.
+/*!
+  \param r The frequency index of the table.
+
+  \return The row in XsecData or in the store.
+*/
+Index GasAbsLookup::XsecRow(const Index r) const {
+  return xsec_rows.empty() ? r : xsec_rows[r];
+}
+
+//! The absorption cross sections of the table, whatever the storage.
+/*!
+  \return A copy of the cross sections, decoded to doubles, and with
+  the index maps of an adapted view applied.
+*/
+Tensor4 GasAbsLookup::XsecUnpacked() const {
+  if (not xsec_store) return xsec;
+
+  const LookupXsecStore& store = *xsec_store;
+  Tensor4 x(store.nbooks(),
+            xsec_pages.empty() ? store.npages() : xsec_pages.nelem(),
+            xsec_rows.empty() ? store.nrows() : xsec_rows.nelem(),
+            store.ncols());
+  for (Index b = 0; b < x.nbooks(); b++)
+    for (Index p = 0; p < x.npages(); p++)
+      for (Index r = 0; r < x.nrows(); r++)
+        for (Index c = 0; c < x.ncols(); c++)
+          x(b, p, r, c) = XsecPage(p) < 0
+                              ? NAN
+                              : store.Value(b, XsecPage(p), XsecRow(r), c);
+  return x;
+}
+
+//! Runtime check of the size of the cross sections, whatever the storage.
+/*!
+  \param b Required number of temperature perturbations.
+  \param p Required number of species and nonlinear perturbations.
+  \param r Required number of frequencies.
+  \param c Required number of pressures.
+*/
+void GasAbsLookup::XsecCheckSize(Index b, Index p, Index r, Index c) const {
+  if (not xsec_store) {
+    chk_size("xsec", xsec, b, p, r, c);
+    return;
+  }
+
+  const Index nb = xsec_store->nbooks();
+  const Index np = xsec_pages.empty() ? xsec_store->npages() : xsec_pages.nelem();
+  const Index nr = xsec_rows.empty() ? xsec_store->nrows() : xsec_rows.nelem();
+  const Index nc = xsec_store->ncols();
+  if (nb not_eq b or np not_eq p or nr not_eq r or nc not_eq c) {
+    ostringstream os;
+    os << "The object *xsec* does not have the right size.\n"
+       << "Dimensions should be:"
+       << " " << b << " " << p << " " << r << " " << c
+       << ",\nbut they are:         "
+       << " " << nb << " " << np << " " << nr << " " << nc << ".";
+    throw runtime_error(os.str());
+  }
+}
+
+//! Drops the shared cross sections and the index maps of a view.
+/*!
+  Must be called wherever xsec is set anew, so that the table uses the
+  in-memory xsec and no index maps of an earlier adapted view are left
+  to point into it.
+*/
+void GasAbsLookup::XsecStoreReset() {
+  xsec_store.reset();
+  xsec_pages.clear();
+  xsec_rows.clear();
+}
+
+//! Whether the table is an adapted view of shared cross sections.
+bool GasAbsLookup::IsView() const {
+  return not xsec_pages.empty() or not xsec_rows.empty();
+}
+
+//! Whether the cross sections are read from a memory map.
+bool GasAbsLookup::IsMapped() const {
+  return xsec_store and xsec_store->IsMapped();
+}
+
+//! The storage type of the cross sections.
+LookupStorage GasAbsLookup::Storage() const {
+  return xsec_store ? xsec_store->Storage() : LookupStorage::Double;
+}
+
+//! Change the storage type of the cross sections.
+/*!
+  The cross sections are decoded and packed in the new storage. Float
+  and Quantized cross sections are kept as an image in memory, and the
+  in-memory xsec is cleared. Going from Quantized to Float or back to
+  Double keeps the error of the quantization. An adapted view gets a
+  copy of only its own cross sections.
+
+  \param storage The new storage type.
+  \param verbosity As WSV.
+*/
+void GasAbsLookup::SetStorage(const LookupStorage storage,
+                              const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  if (storage == Storage()) return;
+
+  if (storage == LookupStorage::Double) {
+    xsec = XsecUnpacked();
+    XsecStoreReset();
+  } else {
+    // Only the new image and the old cross sections are alive at once,
+    // the image is moved into the store
+    std::string image = xsec_store
+                            ? lookup_xsec_image(XsecUnpacked(), storage)
+                            : lookup_xsec_image(xsec, storage);
+    xsec = Tensor4();
+    XsecStoreReset();
+    xsec_store = std::make_shared<const LookupXsecStore>(std::move(image));
+  }
+
+  out2 << "  Lookup table storage is now " << lookupstorage2string(storage)
+       << ", with a relative error of at most " << StorageErrorBound()
+       << ".\n";
+}
+
+//! Bound of the relative error of the storage of the cross sections.
+/*!
+  This is the error of the stored values only, the interpolation
+  errors of Extract come on top of it. For an adapted view this is
+  the bound of all shared cross sections.
+
+  \return The largest relative error of any cross section.
+*/
+Numeric GasAbsLookup::StorageErrorBound() const {
+  switch (Storage()) {
+    case LookupStorage::Double:
+      return 0;
+    case LookupStorage::Float:
+      return std::ldexp(1., -24);
+    case LookupStorage::Quantized: {
+      const LookupXsecStore& store = *xsec_store;
+      const Index nblocks = store.nbooks() * store.npages() * store.nrows();
+      // Half a step, plus the rounding of the offset to float at the
+      // ends of the range and for constant profiles
+      Numeric err = 0;
+      for (Index i = 0; i < nblocks; i++) {
+        const float* block = store.Blocks() + 2 * i;
+        err = std::max(err,
+                       0.5 * block[1] + std::ldexp(std::abs(block[0]), -23));
+      }
+      return std::expm1(err);
+    }
+  }
+  std::terminate();
+}
+
+//! Write the table in the memory mapped format.
+/*!
+  All of the table but the cross sections is written as a binary XML
+  table to filename. The cross sections are written in their storage
+  type to filename.xsec, which ReadMapped memory maps. Relative names
+  are taken in the output directory, as for all XML files.
+
+  \param filename The name of the XML file.
+  \param verbosity As WSV.
+*/
+void GasAbsLookup::WriteMapped(const String& filename,
+                               const Verbosity& verbosity) const {
+  GasAbsLookup meta;
+  meta.species = species;
+  meta.nonlinear_species = nonlinear_species;
+  meta.f_grid = f_grid;
+  meta.p_grid = p_grid;
+  meta.vmrs_ref = vmrs_ref;
+  meta.t_ref = t_ref;
+  meta.t_pert = t_pert;
+  meta.nls_pert = nls_pert;
+  // Binary, so that the grids are exact and the table can be adapted to
+  // the frequency grid it was calculated for
+  xml_write_to_file(filename, meta, FILE_TYPE_BINARY, 0, verbosity);
+
+  const String xsecfile = add_basedir(filename) + ".xsec";
+  std::ofstream os(xsecfile.c_str(), std::ios::binary);
+  if (not os) {
+    ostringstream es;
+    es << "Cannot open " << xsecfile << " for writing";
+    throw runtime_error(es.str());
+  }
+
+  if (not xsec_store) {
+    lookup_xsec_write(os, xsec, LookupStorage::Double);
+  } else if (xsec_store->Image() and not IsView()) {
+    os.write(xsec_store->Image(), xsec_store->ImageSize());
+  } else {
+    // Only the cross sections of the view, or of in-memory doubles
+    ArrayOfIndex pages(xsec_pages.empty() ? xsec_store->npages()
+                                          : xsec_pages.nelem());
+    ArrayOfIndex rows(xsec_rows.empty() ? xsec_store->nrows()
+                                        : xsec_rows.nelem());
+    for (Index i = 0; i < pages.nelem(); i++) pages[i] = XsecPage(i);
+    for (Index i = 0; i < rows.nelem(); i++) rows[i] = XsecRow(i);
+    const std::string image = lookup_xsec_select(*xsec_store, pages, rows);
+    os.write(image.data(), image.size());
+  }
+
+  if (not os) {
+    ostringstream es;
+    es << "Error writing " << xsecfile;
+    throw runtime_error(es.str());
+  }
+}
+
+//! Read a table in the memory mapped format.
+/*!
+  Reads the XML file written by WriteMapped and memory maps the cross
+  sections from the .xsec file next to it. The XML file is searched
+  for in the include and data paths as all XML files, and the .xsec
+  file is taken next to the file that is found. Nothing of the cross sections is read
+  here, pages are loaded on demand by Extract. The storage type is
+  the one the file was written with.
+
+  \param filename The name of the XML file.
+  \param verbosity As WSV.
+*/
+void GasAbsLookup::ReadMapped(const String& filename,
+                              const Verbosity& verbosity) {
+  String xml_file = filename;
+  find_xml_file(xml_file, verbosity);
+
+  // Named, a temporary std::string would select the in-memory image
+  const String xsecfile = xml_file + ".xsec";
+  GasAbsLookup table;
+  xml_read_from_file(xml_file, table, verbosity);
+  table.xsec_store = std::make_shared<const LookupXsecStore>(xsecfile);
+  *this = std::move(table);
+}
 
 //! Find positions of new grid points in old grid.
 /*! 
@@ -104,6 +987,11 @@ void find_new_grid_in_old_grid(ArrayOfIndex& pos,
 
   5. Initialize log_p_grid.
 
+  In view mode the cross sections are not copied in step 3. The new
+  table shares them with the original table, and keeps index maps of
+  its species and frequencies in them. Extract reads through these
+  maps.
+
   The method is intended to be called only once per ARTS job, more or
   less directly from a corresponding workspace method. Therefore,
   runtime errors are thrown, rather than assertions, if something is
@@ -111,12 +999,14 @@ void find_new_grid_in_old_grid(ArrayOfIndex& pos,
 
   \param[in] current_species The list of species for the current calculation.
   \param[in] current_f_grid  The list of frequencies for the current calculation.
+  \param[in] view            Keep the cross sections, and only store index maps.
   \param[in] verbosity       Verbosity settings.
 
   \date 2002-12-12
 */
 void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
                          ConstVectorView current_f_grid,
+                         const bool view,
                          const Verbosity& verbosity) {
   CREATE_OUT2;
   CREATE_OUT3;
@@ -226,7 +1116,7 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
       //     b = n_species
       //     c = n_f_grid
       //     d = n_p_grid
-      chk_size("xsec", xsec, 1, n_species, n_f_grid, n_p_grid);
+      XsecCheckSize(1, n_species, n_f_grid, n_p_grid);
     } else {
       //     Standard case (temperature perturbations,
       //     but no vmr perturbations):
@@ -234,7 +1124,7 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
       //     b = n_species
       //     c = n_f_grid
       //     d = n_p_grid
-      chk_size("xsec", xsec, t_pert.nelem(), n_species, n_f_grid, n_p_grid);
+      XsecCheckSize(t_pert.nelem(), n_species, n_f_grid, n_p_grid);
     }
   } else {
     //     Full case (with temperature perturbations and
@@ -248,7 +1138,7 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
     Index c = n_f_grid;
     Index d = n_p_grid;
 
-    chk_size("xsec", xsec, a, b, c, d);
+    XsecCheckSize(a, b, c, d);
   }
 
   // We also need indices to the positions of the original species
@@ -401,53 +1291,109 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
   }
 
   // Absorption coefficients:
-  new_table.xsec.resize(
-      xsec.nbooks(),
-      n_current_species + n_current_nonlinear_species * (n_nls_pert - 1),
-      n_current_f_grid,
-      xsec.ncols());
-
-  // We have to copy the right species and frequencies from the old to
-  // the new table. Temperature perturbations and pressure grid remain
-  // the same.
-
-  // Do species:
-  for (Index i_s = 0, sp = 0; i_s < n_current_species; ++i_s) {
-    // n_v is the number of VMR perturbations
-    Index n_v;
-    if (current_non_linear[i_s])
-      n_v = n_nls_pert;
-    else
-      n_v = 1;
-
-    //      cout << "i_s / sp / n_v = " << i_s << " / " << sp << " / " << n_v << endl;
-    //      cout << "orig_pos = " << original_spec_pos_in_xsec[i_current_species[i_s]] << endl;
-
-    // Do frequencies:
-    for (Index i_f = 0; i_f < n_current_f_grid; ++i_f) {
-      if (i_current_species[i_s] >= 0) {
-        new_table.xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) =
-            xsec(Range(joker),
-                 Range(original_spec_pos_in_xsec[i_current_species[i_s]], n_v),
-                 i_current_f_grid[i_f],
-                 Range(joker));
-      } else {
-        // Here we handle the case of the trivial species, which we simply
-        // set to NAN:
-        new_table.xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) = NAN;
-      }
 
-      //           cout << "result: " << xsec( Range(joker),
-      //                                       Range(original_spec_pos_in_xsec[i_current_species[i_s]],n_v),
-      //                                       i_current_f_grid[i_f],
-      //                                       Range(joker) ) << endl;
+  // In view mode, in-memory cross sections are moved to a store that
+  // the adapted table can share
+  if (view and not xsec_store) {
+    xsec_store = std::make_shared<const LookupXsecStore>(std::move(xsec));
+    xsec = Tensor4();
+  }
+
+  // A memory mapped or packed table that already has the current
+  // species and frequencies is kept as it is
+  bool is_identity = xsec_store and n_current_species == n_species and
+                     n_current_f_grid == n_f_grid;
+  for (Index i = 0; is_identity and i < n_current_species; ++i)
+    is_identity = i_current_species[i] == i;
+  for (Index i = 0; is_identity and i < n_current_f_grid; ++i)
+    is_identity = i_current_f_grid[i] == i;
+
+  if (xsec_store) {
+    // The pages and rows of the store for the right species and
+    // frequencies. Trivial species have no page.
+    ArrayOfIndex pages, rows(n_current_f_grid);
+    for (Index i_s = 0; i_s < n_current_species; ++i_s) {
+      const Index n_v = current_non_linear[i_s] ? n_nls_pert : 1;
+      for (Index v = 0; v < n_v; ++v)
+        pages.push_back(
+            i_current_species[i_s] >= 0
+                ? XsecPage(original_spec_pos_in_xsec[i_current_species[i_s]] +
+                           v)
+                : -1);
     }
+    for (Index i_f = 0; i_f < n_current_f_grid; ++i_f)
+      rows[i_f] = XsecRow(i_current_f_grid[i_f]);
+
+    if (view or is_identity) {
+      // Share the store, and only keep the index maps
+      new_table.xsec_store = xsec_store;
+
+      bool identity_pages = pages.nelem() == xsec_store->npages();
+      for (Index i = 0; identity_pages and i < pages.nelem(); ++i)
+        identity_pages = pages[i] == i;
+      bool identity_rows = rows.nelem() == xsec_store->nrows();
+      for (Index i = 0; identity_rows and i < rows.nelem(); ++i)
+        identity_rows = rows[i] == i;
+
+      if (not identity_pages) new_table.xsec_pages = pages;
+      if (not identity_rows) new_table.xsec_rows = rows;
+    } else {
+      // Copy whole pressure profiles of the right species and
+      // frequencies, in the storage type of the store. Trivial species
+      // are set to NAN.
+      new_table.xsec_store = std::make_shared<const LookupXsecStore>(
+          lookup_xsec_select(*xsec_store, pages, rows));
+    }
+  } else {
+    const ConstTensor4View xsec_data = XsecData();
+    new_table.xsec.resize(
+        xsec_data.nbooks(),
+        n_current_species + n_current_nonlinear_species * (n_nls_pert - 1),
+        n_current_f_grid,
+        xsec_data.ncols());
+
+    // We have to copy the right species and frequencies from the old to
+    // the new table. Temperature perturbations and pressure grid remain
+    // the same.
+
+    // Do species:
+    for (Index i_s = 0, sp = 0; i_s < n_current_species; ++i_s) {
+      // n_v is the number of VMR perturbations
+      Index n_v;
+      if (current_non_linear[i_s])
+        n_v = n_nls_pert;
+      else
+        n_v = 1;
+
+      //      cout << "i_s / sp / n_v = " << i_s << " / " << sp << " / " << n_v << endl;
+      //      cout << "orig_pos = " << original_spec_pos_in_xsec[i_current_species[i_s]] << endl;
+
+      // Do frequencies:
+      for (Index i_f = 0; i_f < n_current_f_grid; ++i_f) {
+        if (i_current_species[i_s] >= 0) {
+          new_table.xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) =
+              xsec_data(Range(joker),
+                        Range(original_spec_pos_in_xsec[i_current_species[i_s]], n_v),
+                        i_current_f_grid[i_f],
+                        Range(joker));
+        } else {
+          // Here we handle the case of the trivial species, which we simply
+          // set to NAN:
+          new_table.xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) = NAN;
+        }
 
-    sp += n_v;
+        //           cout << "result: " << xsec( Range(joker),
+        //                                       Range(original_spec_pos_in_xsec[i_current_species[i_s]],n_v),
+        //                                       i_current_f_grid[i_f],
+        //                                       Range(joker) ) << endl;
+      }
+
+      sp += n_v;
+    }
   }
 
   // 4. Replace original table by the new one.
-  *this = new_table;
+  *this = std::move(new_table);
 
   // 5. Initialize log_p_grid.
   log_p_grid.resize(n_p_grid);
@@ -522,6 +1468,160 @@ void GasAbsLookup::Extract(Matrix& sga,
                            ConstVectorView abs_vmrs,
                            ConstVectorView new_f_grid,
                            const Numeric& extpolfac) const {
+  // Checks on the table and on the input:
+  const Index h2o_index = ExtractChecks(p_interp_order,
+                                        t_interp_order,
+                                        h2o_interp_order,
+                                        f_interp_order,
+                                        abs_vmrs.nelem());
+
+  // Frequency grid positions and weights:
+  ArrayOfIndex f_idx;
+  Matrix f_w;
+  ExtractFrequencyWeights(f_idx, f_w, f_interp_order, new_f_grid);
+
+  sga.resize(species.nelem(), new_f_grid.nelem());
+  ExtractPoint(sga,
+               p_interp_order,
+               t_interp_order,
+               h2o_interp_order,
+               h2o_index,
+               f_idx,
+               f_w,
+               p,
+               T,
+               abs_vmrs,
+               extpolfac);
+
+  // That's it, we're done!
+}
+
+//! Fewest points that ExtractBatch extracts in parallel.
+/*! Starting the threads costs more than extracting a few points, so
+  smaller batches, as the point and its temperature perturbation of
+  propmat_clearskyAddFromLookup, are extracted serially. */
+constexpr Index lookup_extract_batch_parallel = 16;
+
+//! Extract scalar gas absorption coefficients for many atmospheric points.
+/*!
+  This is Extract for all points of, e.g., a propagation path at
+  once. The checks and the frequency grid positions and weights are
+  done once for all points, and batches of at least
+  lookup_extract_batch_parallel points are extracted in parallel.
+  Each point gives exactly the same as Extract.
+
+  \param[out] sga A Tensor3 with scalar gas absorption coefficients
+              [1/m]. Dimension is adjusted automatically to
+              [n_points, n_species, new_f_grid].
+
+  \param[in] p_interp_order Interpolation order for pressure.
+
+  \param[in] t_interp_order Interpolation order for temperature.
+
+  \param[in] h2o_interp_order Interpolation order for water vapor.
+
+  \param[in] f_interp_order Interpolation order for frequency.
+
+  \param[in] p The pressures [Pa]. Dimension: [n_points].
+
+  \param[in] T The temperatures [K]. Dimension: [n_points].
+
+  \param[in] abs_vmrs The VMRs [absolute number]. Dimension:
+             [n_species, n_points].
+
+  \param[in] new_f_grid The frequency grid where absorption should be
+             extracted, see Extract.
+
+  \param[in] extpolfac How much extrapolation to allow.
+
+  \author agent
+*/
+void GasAbsLookup::ExtractBatch(Tensor3& sga,
+                                const Index& p_interp_order,
+                                const Index& t_interp_order,
+                                const Index& h2o_interp_order,
+                                const Index& f_interp_order,
+                                ConstVectorView p,
+                                ConstVectorView T,
+                                ConstMatrixView abs_vmrs,
+                                ConstVectorView new_f_grid,
+                                const Numeric& extpolfac) const {
+  const Index n_points = p.nelem();
+
+  if (T.nelem() != n_points or abs_vmrs.ncols() != n_points) {
+    ostringstream os;
+    os << "Inconsistent number of points for lookup table extraction.\n"
+       << "There are " << n_points << " pressures, " << T.nelem()
+       << " temperatures, and " << abs_vmrs.ncols() << " VMR columns.";
+    throw runtime_error(os.str());
+  }
+
+  // Checks on the table and on the input:
+  const Index h2o_index = ExtractChecks(p_interp_order,
+                                        t_interp_order,
+                                        h2o_interp_order,
+                                        f_interp_order,
+                                        abs_vmrs.nrows());
+
+  // Frequency grid positions and weights, the same for all points:
+  ArrayOfIndex f_idx;
+  Matrix f_w;
+  ExtractFrequencyWeights(f_idx, f_w, f_interp_order, new_f_grid);
+
+  sga.resize(n_points, species.nelem(), new_f_grid.nelem());
+
+  bool failed = false;
+  String fail_msg;
+#pragma omp parallel for if (!arts_omp_in_parallel() && \
+                             n_points >= lookup_extract_batch_parallel)
+  for (Index ip = 0; ip < n_points; ++ip) {
+    if (failed) continue;
+    try {
+      ExtractPoint(sga(ip, joker, joker),
+                   p_interp_order,
+                   t_interp_order,
+                   h2o_interp_order,
+                   h2o_index,
+                   f_idx,
+                   f_w,
+                   p[ip],
+                   T[ip],
+                   abs_vmrs(joker, ip),
+                   extpolfac);
+    } catch (const std::runtime_error& e) {
+      ostringstream os;
+      os << "Extraction failed for point " << ip << ":\n" << e.what();
+#pragma omp critical(gas_abs_lookup_extract_batch)
+      {
+        failed = true;
+        fail_msg = os.str();
+      }
+    }
+  }
+
+  if (failed) throw runtime_error(fail_msg);
+}
+
+//! Checks on the table and on the extraction input.
+/*!
+  Most checks here are asserts, because they check the internal
+  consistency of the lookup table. They should never fail if the
+  table has been created with ARTS.
+
+  \param[in] p_interp_order Interpolation order for pressure.
+  \param[in] t_interp_order Interpolation order for temperature.
+  \param[in] h2o_interp_order Interpolation order for water vapor.
+  \param[in] f_interp_order Interpolation order for frequency.
+  \param[in] n_vmrs Number of VMRs of the extraction.
+
+  \return The index of the H2O species that is perturbed for the
+  nonlinear species, or -1 if there are no nonlinear species.
+*/
+Index GasAbsLookup::ExtractChecks(const Index& p_interp_order,
+                                  const Index& t_interp_order,
+                                  const Index& h2o_interp_order,
+                                  const Index& f_interp_order,
+                                  const Index& n_vmrs) const {
   // 1. Obtain some properties of the lookup table:
 
   // Number of gas species in the table:
@@ -542,10 +1642,6 @@ void GasAbsLookup::Extract(Matrix& sga,
   // Number of nonlinear species perturbations:
   const Index n_nls_pert = nls_pert.nelem();
 
-  // Number of frequencies in new_f_grid, the frequency grid for which we
-  // want to extract.
-  const Index n_new_f_grid = new_f_grid.nelem();
-
   // 2. First some checks on the lookup table itself:
 
   // Most checks here are asserts, because they check the internal
@@ -597,7 +1693,7 @@ void GasAbsLookup::Extract(Matrix& sga,
     //            << b << ", "
     //            << c << ", "
     //            << d << "\n";
-    assert(is_size(xsec, a, b, c, d));
+    XsecCheckSize(a, b, c, d);
   })
 
   // Make sure that log_p_grid is initialized:
@@ -650,7 +1746,7 @@ void GasAbsLookup::Extract(Matrix& sga,
   // 3. Checks on the input variables:
 
   // Check that abs_vmrs has the right dimension:
-  if (!is_size(abs_vmrs, n_species)) {
+  if (n_vmrs != n_species) {
     ostringstream os;
     os << "Number of species in lookup table does not match number\n"
        << "of species for which you want to extract absorption.\n"
@@ -659,9 +1755,33 @@ void GasAbsLookup::Extract(Matrix& sga,
     throw runtime_error(os.str());
   }
 
-  // 4. Set up some things we will need later on:
+  return h2o_index;
+}
+
+//! Frequency grid positions and weights of an extraction.
+/*!
+  With f_interp_order 0 the frequency grid has to have the same size
+  as in the lookup table, or exactly one element. Otherwise it can be
+  an arbitrary grid inside the table range.
+
+  \param[out] f_idx Table frequency index of each interpolation
+              point. Dimension: [new_f_grid * (f_interp_order + 1)].
+  \param[out] f_w The interpolation weights. Dimension:
+              [new_f_grid, f_interp_order + 1].
+  \param[in] f_interp_order Interpolation order for frequency.
+  \param[in] new_f_grid The frequency grid where absorption should be
+             extracted.
+*/
+void GasAbsLookup::ExtractFrequencyWeights(ArrayOfIndex& f_idx,
+                                           Matrix& f_w,
+                                           const Index& f_interp_order,
+                                           ConstVectorView new_f_grid) const {
+  // Number of frequencies in the table:
+  const Index n_f_grid = f_grid.nelem();
 
-  // 4.a Frequency grid positions
+  // Number of frequencies in new_f_grid, the frequency grid for which we
+  // want to extract.
+  const Index n_new_f_grid = new_f_grid.nelem();
 
   // Frequency grid positions. The pointer is used to save copying of the
   // default from the lookup table.
@@ -756,7 +1876,68 @@ void GasAbsLookup::Extract(Matrix& sga,
     gridpos_poly(fgp_local, f_grid, new_f_grid, f_interp_order);
   }
 
-  // 4.b Other stuff
+  // Flatten the grid positions, so that the frequency loop of
+  // ExtractPoint runs over plain arrays. The indices are rows of the
+  // cross sections, which differ for an adapted view:
+  const Index n_f_interp = f_interp_order + 1;
+  f_idx.resize(n_new_f_grid * n_f_interp);
+  f_w.resize(n_new_f_grid, n_f_interp);
+  for (Index i = 0; i < n_new_f_grid; ++i) {
+    assert((*fgp)[i].idx.nelem() == n_f_interp);
+    for (Index k = 0; k < n_f_interp; ++k) {
+      f_idx[i * n_f_interp + k] = XsecRow((*fgp)[i].idx[k]);
+      f_w(i, k) = (*fgp)[i].w[k];
+    }
+  }
+}
+
+//! Extract scalar gas absorption coefficients at one point.
+/*!
+  The work horse of Extract and ExtractBatch. The input must have
+  passed ExtractChecks.
+
+  \param[out] sga Scalar gas absorption coefficients [1/m]. Must have
+              dimension [n_species, new_f_grid].
+  \param[in] p_interp_order Interpolation order for pressure.
+  \param[in] t_interp_order Interpolation order for temperature.
+  \param[in] h2o_interp_order Interpolation order for water vapor.
+  \param[in] h2o_index As returned by ExtractChecks.
+  \param[in] f_idx As from ExtractFrequencyWeights.
+  \param[in] f_w As from ExtractFrequencyWeights.
+  \param[in] p The pressure [Pa].
+  \param[in] T The temperature [K].
+  \param[in] abs_vmrs The VMRs [absolute number]. Dimension: [species].
+  \param[in] extpolfac How much extrapolation to allow.
+*/
+void GasAbsLookup::ExtractPoint(MatrixView sga,
+                                const Index& p_interp_order,
+                                const Index& t_interp_order,
+                                const Index& h2o_interp_order,
+                                const Index& h2o_index,
+                                const ArrayOfIndex& f_idx,
+                                ConstMatrixView f_w,
+                                const Numeric& p,
+                                const Numeric& T,
+                                ConstVectorView abs_vmrs,
+                                const Numeric& extpolfac) const {
+  // Number of gas species in the table:
+  const Index n_species = species.nelem();
+
+  // Number of nonlinear species:
+  const Index n_nls = nonlinear_species.nelem();
+
+  // Number of pressure grid points in the table:
+  const Index n_p_grid = p_grid.nelem();
+
+  // Number of temperature perturbations:
+  const Index n_t_pert = t_pert.nelem();
+
+  // Number of nonlinear species perturbations:
+  const Index n_nls_pert = nls_pert.nelem();
+
+  // The cross sections, in memory, memory mapped or packed:
+  const LookupStorage storage = Storage();
+  const ConstTensor4View xsec_data = XsecData();
 
   // Flag for temperature interpolation, if this is not 0 we want
   // to do T interpolation:
@@ -773,7 +1954,7 @@ void GasAbsLookup::Extract(Matrix& sga,
   // n = n0*T0/p0 * p/T or n = p/kB/t, ideal gas law
   const Numeric n = number_density(p, T);
 
-  // 5. Determine pressure grid position and interpolation weights:
+  // 1. Determine pressure grid position and interpolation weights:
 
   // Check that p is inside the grid. (p_grid is sorted in decreasing order.)
   {
@@ -800,92 +1981,31 @@ void GasAbsLookup::Extract(Matrix& sga,
   gridpos_poly(pgp, log_p_grid, log(p), p_interp_order);
 
   // Pressure interpolation weights:
-  Vector pitw;
-  pitw.resize(p_interp_order + 1);
+  Vector pitw(p_interp_order + 1);
   interpweights(pitw, pgp[0]);
 
-  // Define also other grid positions and interpolation weights here, so that
-  // we do not have to allocate them over and over in the loops below.
-
-  // Define the ArrayOfGridPosPoly that corresponds to "no interpolation at all".
-  ArrayOfGridPosPoly gp_trivial(1);
-  gp_trivial[0].idx.resize(1);
-  gp_trivial[0].w.resize(1);
-  gp_trivial[0].idx[0] = 0;
-  gp_trivial[0].w[0] = 1;
-
-  // Temperature grid positions.
-  ArrayOfGridPosPoly tgp_withT(1);  // Only a scalar.
-  ArrayOfGridPosPoly* tgp;  // Pointer to either tgp_withT or gp_trivial.
-
-  // Set this_t_interp_order, depending on whether we do T interpolation or not.
-  Index this_t_interp_order;  // Local T interpolation order
-  if (do_T) {
-    this_t_interp_order = t_interp_order;
-    tgp = &tgp_withT;
-  } else {
-    // For the !do_T case we simply take the single
-    // temperature that is there, so we point tgp accordingly.
-    this_t_interp_order = 0;
-    tgp = &gp_trivial;
-  }
+  // The GridPosPoly that corresponds to "no interpolation at all".
+  GridPosPoly gp_trivial;
+  gp_trivial.idx.resize(1);
+  gp_trivial.w.resize(1);
+  gp_trivial.idx[0] = 0;
+  gp_trivial.w[0] = 1;
 
-  // H2O(VMR) grid positions. vgp is what will be used in the interpolation.
-  // Depending on species, it is either pointed to gp_trivial, or to vgp_h2o.
-  ArrayOfGridPosPoly* vgp;
-  ArrayOfGridPosPoly vgp_h2o(1);  // only a scalar
+  // Temperature and H2O(VMR) grid positions, only scalars.
+  ArrayOfGridPosPoly tgp_withT(1), vgp_h2o(1);
 
-  // 6. We do the T and VMR interpolation for the pressure levels
+  // 2. We do the T and VMR interpolation for the pressure levels
   // that are used in the pressure interpolation. (How many depends on
-  // p_interp_order.)
-
-  // To store the interpolated result for the p_interp_order+1
-  // pressure levels:
-  // xsec dimensions are:
-  //   Temperature
-  //   H2O
-  //   Frequency
-  //   Pressure
-  // Dimensions of pre_interpolated are:
-  //   Pressure    (interpolation points)
-  //   Species
-  //   Temperature (always 1)
-  //   H2O         (always 1)
-  //   Frequency
-
-  Tensor5 xsec_pre_interpolated;
-  xsec_pre_interpolated.resize(
-      p_interp_order + 1, n_species, 1, 1, n_new_f_grid);
-
-  // Define variables for interpolation weights outside the loops.
-  // We will make itw point to either the weights with H2O interpolation, or
-  // the ones without.
-  Tensor4 itw_withH2O, itw_noH2O, *itw;
-
+  // p_interp_order.) The pressure, temperature and H2O weights are
+  // multiplied together and shared by all frequencies, and the
+  // frequency interpolation is the innermost loop.
+  sga = 0;
   for (Index pi = 0; pi < p_interp_order + 1; ++pi) {
-    // Throw a runtime error if one of the reference VMR profiles is zero, but
-    // abs_vmrs is not. (This means that the lookup table was calculated with a
-    // reference profile of zero for that gas.)
-    //      for (Index si=0; si<n_species; ++si)
-    //        if ( (vmrs_ref(si,pi) == 0) &&
-    //            (abs_vmrs[si]    != 0) )
-    //        {
-    //          ostringstream os;
-    //          os << "Reference VMR profile is zero, you cannot extract\n"
-    //          << "Absorption for this species.\n"
-    //          << "Species: " << si
-    //          << " (" << get_species_name(species[si]) << ")\n"
-    //          << "Lookup table pressure level: " << pi
-    //          << " (" <<  p_grid[pi] << " Pa).";
-    //          throw runtime_error( os.str() );
-    //        }
-
     // Index into p_grid:
     const Index this_p_grid_index = pgp[0].idx[pi];
 
     // Determine temperature grid position. This is only done if we
-    // want temperature interpolation, but the variable tgp has to
-    // be visible also outside for later use:
+    // want temperature interpolation.
     if (do_T) {
       // Temperature in the atmosphere is altitude
       // dependent. When we do the interpolation for the pressure level
@@ -912,14 +2032,11 @@ void GasAbsLookup::Extract(Matrix& sga,
       // version of using the real temperature and humidity, not
       // the interpolated one.
 
-      //          const Numeric effective_T_ref = interp(pitw,t_ref,pgp);
       const Numeric effective_T_ref = t_ref[this_p_grid_index];
 
       // Convert temperature to offset from t_ref:
       const Numeric T_offset = T - effective_T_ref;
 
-      //          cout << "T_offset = " << T_offset << endl;
-
       // Check that temperature offset is inside the allowed range.
       {
         const Numeric t_min = t_pert[0] - extpolfac * (t_pert[1] - t_pert[0]);
@@ -944,10 +2061,13 @@ void GasAbsLookup::Extract(Matrix& sga,
       gridpos_poly(tgp_withT, t_pert, T_offset, t_interp_order, extpolfac);
     }
 
+    // For the !do_T case we simply take the single temperature that is
+    // there.
+    const GridPosPoly& tgp = do_T ? tgp_withT[0] : gp_trivial;
+
     // Determine the H2O VMR grid position. We need to do this only
     // once, since the only species who's VMR is interpolated is
-    // H2O. We do this only if there are nonlinear species, but the
-    // variable has to be visible later.
+    // H2O. We do this only if there are nonlinear species.
     if (n_nls > 0) {
       // Similar to the T case, we first interpolate the reference
       // VMR to the pressure of extraction, then compare with
@@ -964,9 +2084,6 @@ void GasAbsLookup::Extract(Matrix& sga,
       // version of using the real temperature and humidity, not
       // the interpolated one.
 
-      //           const Numeric effective_vmr_ref = interp(pitw,
-      //                                                    vmrs_ref(h2o_index, Range(joker)),
-      //                                                    pgp);
       const Numeric effective_vmr_ref = vmrs_ref(h2o_index, this_p_grid_index);
 
       // Fractional VMR:
@@ -1003,42 +2120,13 @@ void GasAbsLookup::Extract(Matrix& sga,
       gridpos_poly(vgp_h2o, nls_pert, VMR_frac, h2o_interp_order, extpolfac);
     }
 
-    // Precalculate interpolation weights.
-    if (n_nls < n_species) {
-      // Precalculate weights without H2O interpolation if there are less
-      // nonlinear species than total species. (So at least one species
-      // without H2O interpolation.)
-      itw_noH2O.resize(1,
-                       1,
-                       n_new_f_grid,
-                       (this_t_interp_order + 1) * (1) *  // H2O dimension
-                           (f_interp_order + 1));
-      interpweights(itw_noH2O, *tgp, gp_trivial, *fgp);
-    }
-    if (n_nls > 0) {
-      // Precalculate weights with H2O interpolation if there is at least
-      // one nonlinear species.
-      itw_withH2O.resize(1,
-                         1,
-                         n_new_f_grid,
-                         (this_t_interp_order + 1) * (h2o_interp_order + 1) *
-                             (f_interp_order + 1));
-      interpweights(itw_withH2O, *tgp, vgp_h2o, *fgp);
-    }
-
-    // 7. Loop species:
+    // 3. Loop species:
     Index fpi = 0;
     for (Index si = 0; si < n_species; ++si) {
       // Flag for VMR interpolation, if this is not 0 we want to
       // do VMR interpolation:
       const Index do_VMR = non_linear[si];
 
-      // For interpolation result.
-      // Fixed pressure level and species.
-      // Free dimension is T, H2O, and frequency.
-      Tensor3View res(xsec_pre_interpolated(
-          pi, si, Range(joker), Range(joker), Range(joker)));
-
       // Ignore species such as Zeeman and free_electrons which are not
       // stored in the lookup table. For those the result is set to 0.
       if (is_zeeman(species[si]) ||
@@ -1051,38 +2139,50 @@ void GasAbsLookup::Extract(Matrix& sga,
              << species[si][0].Name() << "\"";
           throw runtime_error(os.str());
         }
-        res = 0.;
         fpi++;
         continue;
       }
 
-      // Set h2o related interpolation parameters:
-      Index this_h2o_extent;  // Range of H2O interpolation
-      if (do_VMR) {
-        vgp = &vgp_h2o;
-        this_h2o_extent = n_nls_pert;
-        itw = &itw_withH2O;
-      } else {
-        vgp = &gp_trivial;
-        this_h2o_extent = 1;
-        itw = &itw_noH2O;
+      // H2O grid position, trivial for linear species:
+      const GridPosPoly& vgp = do_VMR ? vgp_h2o[0] : gp_trivial;
+
+      // Add up the temperature and H2O interpolation points of this
+      // pressure level, each interpolated in frequency.
+      VectorView res = sga(si, joker);
+      for (Index it = 0; it < tgp.idx.nelem(); ++it) {
+        for (Index iv = 0; iv < vgp.idx.nelem(); ++iv) {
+          const Numeric w = pitw[pi] * tgp.w[it] * vgp.w[iv];
+          const Index ti = tgp.idx[it];
+          const Index vi = XsecPage(fpi + vgp.idx[iv]);
+          switch (storage) {
+            case LookupStorage::Double:
+              lookup_add_column(
+                  res,
+                  w,
+                  xsec_data(ti, vi, Range(joker), this_p_grid_index),
+                  f_idx,
+                  f_w);
+              break;
+            case LookupStorage::Float:
+              lookup_add_column(
+                  res,
+                  w,
+                  LookupFloatColumn(*xsec_store, ti, vi, this_p_grid_index),
+                  f_idx,
+                  f_w);
+              break;
+            case LookupStorage::Quantized:
+              lookup_add_column(
+                  res,
+                  w,
+                  LookupQuantizedColumn(*xsec_store, ti, vi, this_p_grid_index),
+                  f_idx,
+                  f_w);
+              break;
+          }
+        }
       }
 
-      // Get the right view on xsec.
-      ConstTensor3View this_xsec =
-          xsec(Range(joker),                 // Temperature range
-               Range(fpi, this_h2o_extent),  // VMR profile range
-               Range(joker),                 // Frequency range
-               this_p_grid_index);           // Pressure index
-
-      // Do interpolation.
-      interp(res,        // result
-             *itw,       // weights
-             this_xsec,  // input
-             *tgp,
-             *vgp,
-             *fgp);  // grid positions
-
       // Increase fpi. fpi marks the position of the first profile
       // of the current species in xsec. This is needed to find
       // the right subsection of xsec in the presence of nonlinear species.
@@ -1095,42 +2195,16 @@ void GasAbsLookup::Extract(Matrix& sga,
 
     // fpi should have reached the end of that dimension of xsec. Check
     // this with an assertion:
-    assert(fpi == xsec.npages());
+    assert(fpi == n_species + n_nls * (n_nls_pert - 1));
 
   }  // End of pressure index loop (below and above gp)
 
-  // Now we have to interpolate between the p_interp_order+1 pressure levels
-
-  // It is a "red" 1D interpolation case we are talking about here.
-  // (But for a matrix in frequency and species.) Doing a loop over
-  // frequency and species with an interp call inside would be
-  // unefficient, so we do this by hand here.
-  sga.resize(n_species, n_new_f_grid);
-  sga = 0;
-  for (Index pi = 0; pi < p_interp_order + 1; ++pi) {
-    // Multiply pre interpolated quantities with pressure interpolation weights.
-    // Dimensions of pre_interpolated are:
-    //   Pressure    (interpolation points)
-    //   Species
-    //   Temperature (always 1)
-    //   H2O         (always 1)
-    //   Frequency
-    xsec_pre_interpolated(
-        pi, Range(joker), Range(joker), Range(joker), Range(joker)) *= pitw[pi];
-
-    // Add up in sga.
-    // Dimensions of sga are (species, frequency)
-    sga += xsec_pre_interpolated(pi, Range(joker), 0, 0, Range(joker));
-  }
-
   // Watch out, this is not yet the final result, we
   // need to multiply with the number density of the species, i.e.,
   // with the total number density n, times the VMR of the
   // species:
   for (Index si = 0; si < n_species; ++si)
     sga(si, Range(joker)) *= (n * abs_vmrs[si]);
-
-  // That's it, we're done!
 }
 
 const Vector& GasAbsLookup::GetFgrid() const { return f_grid; }
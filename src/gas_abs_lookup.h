@@ -26,6 +26,7 @@
 #ifndef gas_abs_lookup_h
 #define gas_abs_lookup_h
 
+#include <memory>
 #include "abs_species_tags.h"
 #include "absorption.h"
 #include "interpolation_poly.h"
@@ -37,6 +38,44 @@ class bifstream;
 class bofstream;
 class Agenda;
 class Workspace;
+class LookupXsecStore;
+
+//! Storage type of the absorption cross sections of a lookup table.
+/*! Double keeps the cross sections as they are calculated. Float
+    halves the memory, with a relative error of 2^-24. Quantized stores
+    the logarithm of each cross section as a 16 bit code, with one
+    offset and step for each pressure profile of each frequency. This
+    takes about a quarter of the memory, and the relative error of each
+    profile is set by the range of its values, see
+    GasAbsLookup::StorageErrorBound. */
+enum class LookupStorage : Index {
+  Double,
+  Float,
+  Quantized,
+};  // LookupStorage
+
+inline LookupStorage string2lookupstorage(const String& in) {
+  if (in == "Double")
+    return LookupStorage::Double;
+  else if (in == "Float")
+    return LookupStorage::Float;
+  else if (in == "Quantized")
+    return LookupStorage::Quantized;
+  else
+    throw std::runtime_error(
+        "Cannot recognize the lookup table storage type \"" + in +
+        "\", valid are \"Double\", \"Float\" and \"Quantized\"");
+}
+
+inline String lookupstorage2string(LookupStorage in) {
+  if (in == LookupStorage::Double)
+    return "Double";
+  else if (in == LookupStorage::Float)
+    return "Float";
+  else if (in == LookupStorage::Quantized)
+    return "Quantized";
+  std::terminate();
+}
 
 //! An absorption lookup table.
 /*! This class holds an absorption lookup table, as well as all
@@ -53,12 +92,16 @@ class GasAbsLookup {
         t_ref(),
         t_pert(),
         nls_pert(),
-        xsec() { /* Nothing to do here */
+        xsec(),
+        xsec_store(),
+        xsec_pages(),
+        xsec_rows() { /* Nothing to do here */
   }
 
   // Documentation is with the implementation!
   void Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
              ConstVectorView current_f_grid,
+             const bool view,
              const Verbosity& verbosity);
 
   // Documentation is with the implementation!
@@ -73,10 +116,43 @@ class GasAbsLookup {
                ConstVectorView new_f_grid,
                const Numeric& extpolfac) const;
 
+  // Documentation is with the implementation!
+  void ExtractBatch(Tensor3& sga,
+                    const Index& p_interp_order,
+                    const Index& t_interp_order,
+                    const Index& h2o_interp_order,
+                    const Index& f_interp_order,
+                    ConstVectorView p,
+                    ConstVectorView T,
+                    ConstMatrixView abs_vmrs,
+                    ConstVectorView new_f_grid,
+                    const Numeric& extpolfac) const;
+
   const Vector& GetFgrid() const;
 
   const Vector& GetPgrid() const;
 
+  // Documentation is with the implementation!
+  void WriteMapped(const String& filename, const Verbosity& verbosity) const;
+
+  // Documentation is with the implementation!
+  void ReadMapped(const String& filename, const Verbosity& verbosity);
+
+  // Documentation is with the implementation!
+  bool IsMapped() const;
+
+  // Documentation is with the implementation!
+  bool IsView() const;
+
+  // Documentation is with the implementation!
+  LookupStorage Storage() const;
+
+  // Documentation is with the implementation!
+  void SetStorage(LookupStorage storage, const Verbosity& verbosity);
+
+  // Documentation is with the implementation!
+  Numeric StorageErrorBound() const;
+
   Index GetSpeciesIndex(const Index& isp) const {
     return species[isp][0].Species();
   }
@@ -106,7 +182,10 @@ class GasAbsLookup {
       const Vector& abs_t,
       const Vector& abs_t_pert,
       const Vector& abs_nls_pert,
+      const ArrayOfArrayOfAbsorptionLines& abs_lines_per_species,
       const Agenda& abs_xsec_agenda,
+      // WS Generic Input:
+      const String& checkpoint_basename,
       // Verbosity object:
       const Verbosity& verbosity);
 
@@ -188,10 +267,59 @@ class GasAbsLookup {
   /** The vector of perturbations for the VMRs of the nonlinear species */
   Vector& NLSPert() {return nls_pert;}
   
-  /** Absorption cross sections */
+  /** Absorption cross sections
+   *
+   * Empty for tables that are read from a memory map, see IsMapped(),
+   * for tables that are not stored as Double, see Storage(), and for
+   * adapted views, see IsView()
+   */
   Tensor4& Xsec() {return xsec;}
   
  private:
+  // Documentation is with the implementation!
+  ConstTensor4View XsecData() const;
+
+  // Documentation is with the implementation!
+  Index XsecPage(const Index p) const;
+
+  // Documentation is with the implementation!
+  Index XsecRow(const Index r) const;
+
+  // Documentation is with the implementation!
+  Tensor4 XsecUnpacked() const;
+
+  // Documentation is with the implementation!
+  void XsecCheckSize(Index b, Index p, Index r, Index c) const;
+
+  // Documentation is with the implementation!
+  void XsecStoreReset();
+
+  // Documentation is with the implementation!
+  Index ExtractChecks(const Index& p_interp_order,
+                      const Index& t_interp_order,
+                      const Index& h2o_interp_order,
+                      const Index& f_interp_order,
+                      const Index& n_vmrs) const;
+
+  // Documentation is with the implementation!
+  void ExtractFrequencyWeights(ArrayOfIndex& f_idx,
+                               Matrix& f_w,
+                               const Index& f_interp_order,
+                               ConstVectorView new_f_grid) const;
+
+  // Documentation is with the implementation!
+  void ExtractPoint(MatrixView sga,
+                    const Index& p_interp_order,
+                    const Index& t_interp_order,
+                    const Index& h2o_interp_order,
+                    const Index& h2o_index,
+                    const ArrayOfIndex& f_idx,
+                    ConstMatrixView f_w,
+                    const Numeric& p,
+                    const Numeric& T,
+                    ConstVectorView abs_vmrs,
+                    const Numeric& extpolfac) const;
+
   //! The species tags for which the table is valid.
   ArrayOfArrayOfSpeciesTag species;
 
@@ -307,6 +435,26 @@ class GasAbsLookup {
     dimensions of abs_per_tg in ARTS-1-0. This should simplify
     computation of the lookup table with the old ARTS version.  */
   Tensor4 xsec;
+
+  //! Packed absorption cross sections.
+  /*! If set, the cross sections are read from here instead of xsec,
+    which is then empty. This is either a memory map of a cross section
+    file, or an in-memory image of the cross sections in Float or
+    Quantized storage. It is shared between copies of the table, and
+    the pages of a memory map are shared between all processes that map
+    the same file. */
+  std::shared_ptr<const LookupXsecStore> xsec_store;
+
+  //! Species index map of an adapted view.
+  /*! The page of xsec_store for each species, or nonlinear
+    perturbation, page of this table, -1 for trivial species. Empty if
+    the pages are the same. */
+  ArrayOfIndex xsec_pages;
+
+  //! Frequency index map of an adapted view.
+  /*! The row of xsec_store for each frequency of this table. Empty if
+    the rows are the same. */
+  ArrayOfIndex xsec_rows;
 };
 
 ostream& operator<<(ostream& os, const GasAbsLookup& gal);
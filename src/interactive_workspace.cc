@@ -1,4 +1,9 @@
 #include "interactive_workspace.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <shared_mutex>
 #include "matpackI.h"
 #include "matpackII.h"
 #include "matpackIII.h"
@@ -12,25 +17,160 @@
 #include "agenda_record.h"
 
 extern Verbosity verbosity_at_launch;
-extern std::string string_buffer;
 
 namespace global_data {
 extern map<String, Index> AgendaMap;
 extern Array<MdRecord> md_data;
 extern map<String, Index> WsvGroupMap;
 extern WorkspaceMemoryHandler workspace_memory_handler;
+extern const ArrayOfString wsv_group_names;
 }
 
 using global_data::md_data;
 using global_data::workspace_memory_handler;
+using global_data::wsv_group_names;
+
+/** The shape of a matpack tensor as an array */
+std::array<Index, 1> shape_of(const Vector &x) { return {x.nelem()}; }
+std::array<Index, 2> shape_of(const Matrix &x) {
+  return {x.nrows(), x.ncols()};
+}
+std::array<Index, 3> shape_of(const Tensor3 &x) {
+  return {x.npages(), x.nrows(), x.ncols()};
+}
+std::array<Index, 4> shape_of(const Tensor4 &x) {
+  return {x.nbooks(), x.npages(), x.nrows(), x.ncols()};
+}
+std::array<Index, 5> shape_of(const Tensor5 &x) {
+  return {x.nshelves(), x.nbooks(), x.npages(), x.nrows(), x.ncols()};
+}
+std::array<Index, 6> shape_of(const Tensor6 &x) {
+  return {x.nvitrines(),
+          x.nshelves(),
+          x.nbooks(),
+          x.npages(),
+          x.nrows(),
+          x.ncols()};
+}
+std::array<Index, 7> shape_of(const Tensor7 &x) {
+  return {x.nlibraries(),
+          x.nvitrines(),
+          x.nshelves(),
+          x.nbooks(),
+          x.npages(),
+          x.nrows(),
+          x.ncols()};
+}
+
+/** Set a tensor WSV from a c-array in row-major order
+ *
+ * Nothing is copied if src already is the data of dst, which is the case
+ * when a client has filled the memory returned by resize_tensor_variable
+ * in place. src may also point into dst.
+ *
+ * @param[in,out] dst The tensor to set
+ * @param[in] src The c-array with the new elements
+ * @param[in] dims The new shape of dst
+ */
+template <typename T, typename... Dims>
+void set_tensor(T &dst, const Numeric *src, Dims... dims) {
+  const std::array<Index, sizeof...(Dims)> shape{Index(dims)...};
+  const Index n = (Index(1) * ... * Index(dims));
+
+  if (shape_of(dst) == shape) {
+    if (n and dst.get_c_array() != src)
+      std::memmove(dst.get_c_array(), src, n * sizeof(Numeric));
+  } else {
+    // Copy before releasing the old memory as src may point into it
+    T tmp(static_cast<Index>(dims)...);
+    if (n) std::memcpy(tmp.get_c_array(), src, n * sizeof(Numeric));
+    dst = std::move(tmp);
+  }
+}
+
+/** Resize a tensor WSV and return its data
+ *
+ * The old elements are kept if the shape does not change. The shape comes
+ * from a client, so it is checked before anything is allocated.
+ *
+ * @param[in,out] dst The tensor to resize
+ * @param[in] dims The new shape of dst
+ * @return Pointer to the c-array of dst, NULL if dst is empty
+ * @throw std::runtime_error If an extent is negative or the number of
+ * bytes does not fit in an Index
+ */
+template <typename T, typename... Dims>
+Numeric *resize_tensor(T &dst, Dims... dims) {
+  const std::array<Index, sizeof...(Dims)> shape{Index(dims)...};
+  const Index max_elements =
+      std::numeric_limits<Index>::max() / Index(sizeof(Numeric));
+  Index n = 1;
+  for (std::size_t i = 0; i < shape.size(); ++i) {
+    if (shape[i] < 0) {
+      ostringstream os;
+      os << "Cannot resize variable to the negative extent " << shape[i]
+         << " in dimension " << i << ".";
+      throw std::runtime_error(os.str());
+    }
+    if (shape[i] > 0 and n > max_elements / shape[i]) {
+      ostringstream os;
+      os << "Cannot resize variable, the shape (";
+      for (std::size_t j = 0; j < shape.size(); ++j)
+        os << (j ? ", " : "") << shape[j];
+      os << ") has too many elements.";
+      throw std::runtime_error(os.str());
+    }
+    n *= shape[i];
+  }
+
+  dst.resize(dims...);
+  return dst.empty() ? nullptr : dst.get_c_array();
+}
 
 Index get_wsv_id(const char *);
 
 size_t InteractiveWorkspace::n_anonymous_variables_ = 0;
 std::vector<Callback *> InteractiveWorkspace::callbacks_{};
+std::vector<Index> InteractiveWorkspace::free_variables_{};
+std::vector<InteractiveWorkspace *> InteractiveWorkspace::workspaces_{};
+std::atomic<Index> InteractiveWorkspace::n_stamps_{0};
+std::vector<Index> InteractiveWorkspace::variable_stamps_{};
+
+/** The lock of the variable registry */
+std::shared_mutex registry_mutex;
+
+/** Number of RegistryReadLocks alive on this thread */
+thread_local Index registry_read_depth = 0;
+
+RegistryReadLock::RegistryReadLock() {
+  if (registry_read_depth++ == 0) registry_mutex.lock_shared();
+}
+
+RegistryReadLock::~RegistryReadLock() {
+  if (--registry_read_depth == 0) registry_mutex.unlock_shared();
+}
+
+RegistryUnlock::RegistryUnlock() : depth(registry_read_depth) {
+  if (depth) {
+    registry_read_depth = 0;
+    registry_mutex.unlock_shared();
+  }
+}
+
+RegistryUnlock::~RegistryUnlock() {
+  if (depth) {
+    registry_mutex.lock_shared();
+    registry_read_depth = depth;
+  }
+}
+
+RegistryWriteLock::RegistryWriteLock() : unlock() { registry_mutex.lock(); }
+
+RegistryWriteLock::~RegistryWriteLock() { registry_mutex.unlock(); }
 
 void callback_getaway(Workspace &ws, const MRecord &mr) {
   InteractiveWorkspace &iws = *reinterpret_cast<InteractiveWorkspace *>(&ws);
+  RegistryUnlock unlock;
 #pragma omp critical
   { iws.execute_callback(static_cast<Index>(mr.SetValue())); }
 }
@@ -56,6 +196,8 @@ MdRecord callback_mr = MdRecord("APICallback",
 InteractiveWorkspace::InteractiveWorkspace(const Index verbosity,
                                            const Index agenda_verbosity)
     : Workspace() {
+  RegistryWriteLock lock;
+  workspaces_.push_back(this);
   Workspace::initialize();
   verbosity_at_launch.set_screen_verbosity(verbosity);
   verbosity_at_launch.set_agenda_verbosity(agenda_verbosity);
@@ -76,6 +218,11 @@ InteractiveWorkspace::InteractiveWorkspace(const Index verbosity,
   }
 }
 
+InteractiveWorkspace::~InteractiveWorkspace() {
+  RegistryWriteLock lock;
+  workspaces_.erase(std::find(workspaces_.begin(), workspaces_.end(), this));
+}
+
 void InteractiveWorkspace::initialize() {
   define_wsv_group_names();
   Workspace::define_wsv_data();
@@ -97,7 +244,19 @@ void InteractiveWorkspace::initialize() {
   md_data.push_back(callback_mr);
 }
 
+InteractiveWorkspace::ExecutionScope::ExecutionScope(InteractiveWorkspace &ws)
+    : ws_(ws), outer_start_(ws.execution_start_) {
+  ws_.execution_start_ = ++n_stamps_;
+}
+
+InteractiveWorkspace::ExecutionScope::~ExecutionScope() {
+  ws_.execution_start_ = outer_start_;
+}
+
 const char *InteractiveWorkspace::execute_agenda(const Agenda *a) {
+  RegistryReadLock lock;
+  ExecutionScope scope(*this);
+
   // Need to check size of stack as agenda definitions may have
   // added variables.
   if (wsv_data.size() != ws.size()) {
@@ -106,14 +265,15 @@ const char *InteractiveWorkspace::execute_agenda(const Agenda *a) {
   try {
     a->execute(*this);
   } catch (const std::exception &e) {
-    string_buffer = e.what();
-    return string_buffer.c_str();
+    return set_error(e.what());
   }
   return nullptr;
 }
 
 const char *InteractiveWorkspace::execute_workspace_method(
     long id, const ArrayOfIndex &output, const ArrayOfIndex &input) {
+  RegistryReadLock lock;
+  ExecutionScope scope(*this);
   const MdRecord &m = md_data[id];
 
   // Need to check size of stack as agenda definitions may have
@@ -125,9 +285,17 @@ const char *InteractiveWorkspace::execute_workspace_method(
   // Check if all input variables are initialized.
   for (Index i : input) {
     if (!is_initialized(i)) {
-      string_buffer = "Method " + m.Name() + " needs input " +
-                      wsv_data[i].Name() + " but it is uninitialized.";
-      return string_buffer.c_str();
+      return set_error("Method " + m.Name() + " needs input " +
+                       wsv_data[i].Name() + " but it is uninitialized.");
+    }
+  }
+
+  // Shared variables belong to another workspace
+  for (Index i : output) {
+    if (is_shared(i)) {
+      return set_error("Method " + m.Name() + " cannot write to " +
+                       wsv_data[i].Name() +
+                       ", it is shared from another workspace.");
     }
   }
 
@@ -154,15 +322,14 @@ const char *InteractiveWorkspace::execute_workspace_method(
     }
     getaways[id](*this, mr);
   } catch (const std::exception &e) {
-    string_buffer = e.what();
-    return string_buffer.c_str();
+    return set_error(e.what());
   }
   return nullptr;
 }
 
 void InteractiveWorkspace::set_agenda_variable(Index id, const Agenda &src) {
   using global_data::AgendaMap;
-  Agenda &dst = *reinterpret_cast<Agenda *>(this->operator[](id));
+  Agenda &dst = *reinterpret_cast<Agenda *>(writable_variable(id));
   String old_name = dst.name();
   dst = src;
   if (old_name != "") {
@@ -172,20 +339,20 @@ void InteractiveWorkspace::set_agenda_variable(Index id, const Agenda &src) {
 }
 
 void InteractiveWorkspace::set_index_variable(Index id, const Index &src) {
-  *reinterpret_cast<Index *>(this->operator[](id)) = src;
+  *reinterpret_cast<Index *>(writable_variable(id)) = src;
 }
 
 void InteractiveWorkspace::set_numeric_variable(Index id, const Numeric &src) {
-  *reinterpret_cast<Numeric *>(this->operator[](id)) = src;
+  *reinterpret_cast<Numeric *>(writable_variable(id)) = src;
 }
 
 void InteractiveWorkspace::set_string_variable(Index id, const char *src) {
-  *reinterpret_cast<String *>(this->operator[](id)) = src;
+  *reinterpret_cast<String *>(writable_variable(id)) = src;
 }
 
 void InteractiveWorkspace::set_array_of_string_variable(
     Index id, size_t n, const char *const *src) {
-  ArrayOfString *dst = reinterpret_cast<ArrayOfString *>(this->operator[](id));
+  ArrayOfString *dst = reinterpret_cast<ArrayOfString *>(writable_variable(id));
   dst->resize(n);
   for (size_t i = 0; i < n; ++i) {
     dst->operator[](i) = String(src[i]);
@@ -195,7 +362,7 @@ void InteractiveWorkspace::set_array_of_string_variable(
 void InteractiveWorkspace::set_array_of_index_variable(Index id,
                                                        size_t n,
                                                        const Index *src) {
-  ArrayOfIndex *dst = reinterpret_cast<ArrayOfIndex *>(this->operator[](id));
+  ArrayOfIndex *dst = reinterpret_cast<ArrayOfIndex *>(writable_variable(id));
   dst->resize(n);
   for (size_t i = 0; i < n; ++i) {
     dst->operator[](i) = src[i];
@@ -205,40 +372,28 @@ void InteractiveWorkspace::set_array_of_index_variable(Index id,
 void InteractiveWorkspace::set_vector_variable(Index id,
                                                size_t n,
                                                const Numeric *src) {
-  Vector *dst = reinterpret_cast<Vector *>(this->operator[](id));
-  dst->resize(n);
-  for (size_t i = 0; i < n; ++i) {
-    dst->operator[](i) = src[i];
-  }
+  Vector *dst = reinterpret_cast<Vector *>(writable_variable(id));
+  set_tensor(*dst, src, n);
 }
 
 void InteractiveWorkspace::set_matrix_variable(Index id,
                                                size_t m,
                                                size_t n,
                                                const Numeric *src) {
-  Matrix *dst = reinterpret_cast<Matrix *>(this->operator[](id));
-  dst->resize(m, n);
-  for (size_t i = 0; i < n * m; ++i) {
-    dst->get_c_array()[i] = src[i];
-  }
+  Matrix *dst = reinterpret_cast<Matrix *>(writable_variable(id));
+  set_tensor(*dst, src, m, n);
 }
 
 void InteractiveWorkspace::set_tensor3_variable(
     Index id, size_t l, size_t m, size_t n, const Numeric *src) {
-  Tensor3 *dst = reinterpret_cast<Tensor3 *>(this->operator[](id));
-  dst->resize(l, m, n);
-  for (size_t i = 0; i < l * n * m; ++i) {
-    dst->get_c_array()[i] = src[i];
-  }
+  Tensor3 *dst = reinterpret_cast<Tensor3 *>(writable_variable(id));
+  set_tensor(*dst, src, l, m, n);
 }
 
 void InteractiveWorkspace::set_tensor4_variable(
     Index id, size_t k, size_t l, size_t m, size_t n, const Numeric *src) {
-  Tensor4 *dst = reinterpret_cast<Tensor4 *>(this->operator[](id));
-  dst->resize(k, l, m, n);
-  for (size_t i = 0; i < k * l * m * n; ++i) {
-    dst->get_c_array()[i] = src[i];
-  }
+  Tensor4 *dst = reinterpret_cast<Tensor4 *>(writable_variable(id));
+  set_tensor(*dst, src, k, l, m, n);
 }
 
 void InteractiveWorkspace::set_tensor5_variable(Index id,
@@ -248,11 +403,8 @@ void InteractiveWorkspace::set_tensor5_variable(Index id,
                                                 size_t n,
                                                 size_t o,
                                                 const Numeric *src) {
-  Tensor5 *dst = reinterpret_cast<Tensor5 *>(this->operator[](id));
-  dst->resize(k, l, m, n, o);
-  for (size_t i = 0; i < k * l * m * n * o; ++i) {
-    dst->get_c_array()[i] = src[i];
-  }
+  Tensor5 *dst = reinterpret_cast<Tensor5 *>(writable_variable(id));
+  set_tensor(*dst, src, k, l, m, n, o);
 }
 
 void InteractiveWorkspace::set_tensor6_variable(Index id,
@@ -263,11 +415,8 @@ void InteractiveWorkspace::set_tensor6_variable(Index id,
                                                 size_t o,
                                                 size_t p,
                                                 const Numeric *src) {
-  Tensor6 *dst = reinterpret_cast<Tensor6 *>(this->operator[](id));
-  dst->resize(k, l, m, n, o, p);
-  for (size_t i = 0; i < k * l * m * n * o * p; ++i) {
-    dst->get_c_array()[i] = src[i];
-  }
+  Tensor6 *dst = reinterpret_cast<Tensor6 *>(writable_variable(id));
+  set_tensor(*dst, src, k, l, m, n, o, p);
 }
 
 void InteractiveWorkspace::set_tensor7_variable(Index id,
@@ -279,11 +428,61 @@ void InteractiveWorkspace::set_tensor7_variable(Index id,
                                                 size_t p,
                                                 size_t q,
                                                 const Numeric *src) {
-  Tensor7 *dst = reinterpret_cast<Tensor7 *>(this->operator[](id));
-  dst->resize(k, l, m, n, o, p, q);
-  for (size_t i = 0; i < k * l * m * n * o * p * q; ++i) {
-    dst->get_c_array()[i] = src[i];
+  Tensor7 *dst = reinterpret_cast<Tensor7 *>(writable_variable(id));
+  set_tensor(*dst, src, k, l, m, n, o, p, q);
+}
+
+Numeric *InteractiveWorkspace::resize_tensor_variable(Index id,
+                                                      Index group_id,
+                                                      const long *dims) {
+  const String &group = wsv_group_names[group_id];
+  void *wsv = writable_variable(id);
+
+  Numeric *data = nullptr;
+  if (group == "Vector") {
+    data = resize_tensor(*reinterpret_cast<Vector *>(wsv), dims[0]);
+  } else if (group == "Matrix") {
+    data = resize_tensor(*reinterpret_cast<Matrix *>(wsv), dims[0], dims[1]);
+  } else if (group == "Tensor3") {
+    data = resize_tensor(
+        *reinterpret_cast<Tensor3 *>(wsv), dims[0], dims[1], dims[2]);
+  } else if (group == "Tensor4") {
+    data = resize_tensor(*reinterpret_cast<Tensor4 *>(wsv),
+                         dims[0],
+                         dims[1],
+                         dims[2],
+                         dims[3]);
+  } else if (group == "Tensor5") {
+    data = resize_tensor(*reinterpret_cast<Tensor5 *>(wsv),
+                         dims[0],
+                         dims[1],
+                         dims[2],
+                         dims[3],
+                         dims[4]);
+  } else if (group == "Tensor6") {
+    data = resize_tensor(*reinterpret_cast<Tensor6 *>(wsv),
+                         dims[0],
+                         dims[1],
+                         dims[2],
+                         dims[3],
+                         dims[4],
+                         dims[5]);
+  } else if (group == "Tensor7") {
+    data = resize_tensor(*reinterpret_cast<Tensor7 *>(wsv),
+                         dims[0],
+                         dims[1],
+                         dims[2],
+                         dims[3],
+                         dims[4],
+                         dims[5],
+                         dims[6]);
+  } else {
+    ostringstream os;
+    os << "Cannot resize variable of group " << group
+       << ", only Vector, Matrix and Tensor3-7 are supported.";
+    throw std::runtime_error(os.str());
   }
+  return data;
 }
 
 void InteractiveWorkspace::set_sparse_variable(Index id,
@@ -293,7 +492,7 @@ void InteractiveWorkspace::set_sparse_variable(Index id,
                                                const Numeric *src,
                                                const int *row_inds,
                                                const int *col_inds) {
-  Sparse *dst = reinterpret_cast<Sparse *>(this->operator[](id));
+  Sparse *dst = reinterpret_cast<Sparse *>(writable_variable(id));
   *dst = Sparse(m, n);
 
   Vector elements(nnz);
@@ -309,30 +508,55 @@ void InteractiveWorkspace::set_sparse_variable(Index id,
 }
 
 void InteractiveWorkspace::resize() {
-  Array<stack<WsvStruct *>> ws_new(wsv_data.nelem());
-  std::copy(ws.begin(), ws.end(), ws_new.begin());
+  // The registry may also have shrunk if variables at its end were erased
+  // through another workspace; their stacks are empty in this one
+  Array<WsvStack> ws_new(wsv_data.nelem());
+  const Index n = std::min(ws.nelem(), ws_new.nelem());
+  std::copy(ws.begin(), ws.begin() + n, ws_new.begin());
   std::swap(ws, ws_new);
 }
 
+void InteractiveWorkspace::share_variable(Index id, InteractiveWorkspace &src) {
+  RegistryReadLock lock;
+  if (wsv_data.size() != ws.size()) {
+    resize();
+  }
+  if (!src.is_initialized(id)) {
+    ostringstream os;
+    os << "Cannot share " << wsv_data[id].Name()
+       << ", it is uninitialized in the source workspace.";
+    throw std::runtime_error(os.str());
+  }
+  push(id, src.operator[](id));
+  ws[id].top()->shared = true;
+}
+
+bool InteractiveWorkspace::is_shared(Index id) {
+  if (id >= ws.nelem()) return false;
+  materialize(id);
+  return ws[id].size() && ws[id].top()->shared;
+}
+
+void *InteractiveWorkspace::writable_variable(Index id) {
+  if (is_shared(id)) {
+    ostringstream os;
+    os << "Cannot overwrite " << wsv_data[id].Name()
+       << ", it is shared from another workspace.";
+    throw std::runtime_error(os.str());
+  }
+  return this->operator[](id);
+}
+
 void InteractiveWorkspace::initialize_variable(Index i) {
+  // Only drop the reference to a shared value, it belongs to the source
+  if (is_shared(i)) this->pop(i);
   this->operator[](i);
   this->pop_free(i);
   this->operator[](i);
 }
 
 Index InteractiveWorkspace::add_variable(Index group_id, const char *name) {
-
-  if (wsv_data.size() != ws.size()) {
-    resize();
-  }
-
-  Index id = static_cast<Index>(ws.size());
-
-  ws.push_back(stack<WsvStruct *>());
-  push(ws.size() - 1, nullptr);
-  ws.back().top()->wsv = workspace_memory_handler.allocate(group_id);
-  ws.back().top()->auto_allocated = true;
-  ws.back().top()->initialized = false;
+  RegistryWriteLock lock;
 
   String s;
   if (name) {
@@ -342,29 +566,84 @@ Index InteractiveWorkspace::add_variable(Index group_id, const char *name) {
     stream << "anonymous_variable_" << n_anonymous_variables_;
     s = stream.str();
   }
+  ++n_anonymous_variables_;
 
-  wsv_data.push_back(WsvRecord(s.c_str(), "Created by C API.", group_id));
+  // Reuse the slot of an erased variable, so that the indices of the other
+  // variables stay valid in all workspaces
+  Index id;
+  if (free_variables_.size()) {
+    id = free_variables_.back();
+    free_variables_.pop_back();
+    wsv_data[id] = WsvRecord(s.c_str(), "Created by C API.", group_id);
+  } else {
+    id = wsv_data.nelem();
+    wsv_data.push_back(WsvRecord(s.c_str(), "Created by C API.", group_id));
+  }
   WsvMap[s] = id;
+  variable_stamps_.resize(wsv_data.size(), 0);
+  variable_stamps_[id] = ++n_stamps_;
+
+  if (wsv_data.size() != ws.size()) {
+    resize();
+  }
+
+  push(id, nullptr);
+  ws[id].top()->wsv = workspace_memory_handler.allocate(group_id);
+  ws[id].top()->auto_allocated = true;
+  ws[id].top()->initialized = false;
 
-  ++n_anonymous_variables_;
   return id;
 }
 
 void InteractiveWorkspace::erase_variable(Index i, Index group_id) {
+  RegistryWriteLock lock;
+
+  // An execution may use the variables that existed when it started. Only
+  // a callback of it can have released the lock to let the erase through.
+  const Index stamp =
+      i < Index(variable_stamps_.size()) ? variable_stamps_[i] : 0;
+  for (InteractiveWorkspace *w : workspaces_) {
+    if (w->execution_start_ > stamp && i < w->ws.nelem() &&
+        w->ws[i].size()) {
+      ostringstream os;
+      os << "Cannot erase " << wsv_data[i].Name()
+         << ", it is held by a workspace that is executing.";
+      throw std::runtime_error(os.str());
+    }
+  }
+
+  // The slot is reused by the next variable, so it must not keep values of
+  // this one in any workspace
+  for (InteractiveWorkspace *w : workspaces_) {
+    if (i < w->ws.nelem()) w->clear_stack(i, group_id);
+  }
+
+  WsvMap.erase(wsv_data[i].Name());
+  wsv_data[i] = WsvRecord("", "Erased by C API.", group_id);
+  free_variables_.push_back(i);
+
+  // Give the trailing free slots back
+  while (wsv_data.nelem() && wsv_data.back().Name() == "") {
+    const Index last = wsv_data.nelem() - 1;
+    free_variables_.erase(
+        std::find(free_variables_.begin(), free_variables_.end(), last));
+    wsv_data.pop_back();
+  }
+  if (ws.nelem() > wsv_data.nelem()) {
+    resize();
+  }
+}
+
+void InteractiveWorkspace::clear_stack(Index i, Index group_id) {
   WsvStruct *wsvs;
   while (ws[i].size()) {
     wsvs = ws[i].top();
     if (wsvs->auto_allocated && wsvs->wsv) {
       workspace_memory_handler.deallocate(group_id, wsvs->wsv);
     }
-    delete (wsvs);
+    free_wsv_struct(wsvs);
     ws[i].pop();
   }
-  ws.erase(ws.begin() + i);
-
-  WsvMap.erase(wsv_data[i].Name());
-  wsv_data.erase(wsv_data.begin() + i);
-  --n_anonymous_variables_;
 }
 
 void InteractiveWorkspace::swap(Index i, Index j) {
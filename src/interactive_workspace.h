@@ -29,6 +29,9 @@
 #ifndef _ARTS_INTERACTIVE_WORKSPACE_H_
 #define _ARTS_INTERACTIVE_WORKSPACE_H_
 
+#include <atomic>
+#include <string>
+
 #include "agenda_class.h"
 #include "workspace_ng.h"
 
@@ -76,6 +79,54 @@ class Callback {
   void (*callback_)(InteractiveWorkspace *);
 };
 
+/** Shared access to the variable registry.
+ *
+ * Workspace::wsv_data, Workspace::WsvMap, the callbacks and the include
+ * and data paths are shared by all interactive workspaces. Calls that read
+ * them hold a RegistryReadLock, calls that change them hold a
+ * RegistryWriteLock, so that independent workspaces can be driven from
+ * several client threads.
+ *
+ * Read locks are reentrant on the same thread. A write lock taken on a
+ * thread that holds a read lock releases the read lock until it is done.
+ */
+class RegistryReadLock {
+ public:
+  RegistryReadLock();
+  ~RegistryReadLock();
+  RegistryReadLock(const RegistryReadLock &) = delete;
+  RegistryReadLock &operator=(const RegistryReadLock &) = delete;
+};
+
+/** Release the read lock of the calling thread for the scope of the object.
+ *
+ * Used while a callback into the client runs, so that the callback can add
+ * variables. Callbacks that run on a worker thread of a parallel region
+ * must not add variables, as the read lock is held by another thread.
+ */
+class RegistryUnlock {
+ public:
+  RegistryUnlock();
+  ~RegistryUnlock();
+  RegistryUnlock(const RegistryUnlock &) = delete;
+  RegistryUnlock &operator=(const RegistryUnlock &) = delete;
+
+ private:
+  Index depth;
+};
+
+/** Exclusive access to the variable registry. */
+class RegistryWriteLock {
+ public:
+  RegistryWriteLock();
+  ~RegistryWriteLock();
+  RegistryWriteLock(const RegistryWriteLock &) = delete;
+  RegistryWriteLock &operator=(const RegistryWriteLock &) = delete;
+
+ private:
+  RegistryUnlock unlock;
+};
+
 /** Interactive ARTS workspace
  *
  * The InteractiveWorkspace class extends the ARTS Workspace class with features
@@ -86,6 +137,8 @@ class InteractiveWorkspace : private Workspace {
   InteractiveWorkspace(const Index verbosity = 1,
                        const Index agenda_verbosity = 0);
 
+  ~InteractiveWorkspace();
+
   using Workspace::is_initialized;
   using Workspace::operator[];
 
@@ -239,6 +292,19 @@ class InteractiveWorkspace : private Workspace {
                             size_t p,
                             size_t q,
                             const Numeric *src);
+  /** Resize Vector, Matrix or Tensor3-7 variable in place.
+   *
+   * Returns the memory of the variable, so that a client can fill it
+   * directly. Setting the variable afterwards from the same memory with
+   * one of the set_*_variable methods does not copy anything.
+   *
+   * \param[in] id Workspace id of the variable to resize
+   * \param[in] group_id The group of the variable
+   * \param[in] dims The new shape, only the first entries up to the
+   * dimension of the group are used.
+   * \return Pointer to the c-array of the variable, NULL if it is empty.
+   */
+  Numeric *resize_tensor_variable(Index id, Index group_id, const long *dims);
   /** Deep-copy of Sparse matrix into workspace.
    *
    * Copies a sparse matrix in coordinate format into the workspace.
@@ -278,11 +344,49 @@ class InteractiveWorkspace : private Workspace {
    * @return The WSM index representing the newly added callback.
    */
   static Index add_callback(Callback *cb) {
+    RegistryWriteLock lock;
     Index id = callbacks_.size();
     callbacks_.push_back(cb);
     return id;
   }
 
+  /** Store an error message of this workspace.
+   *
+   * Every workspace has its own error buffer, so that errors of
+   * workspaces that are used concurrently do not overwrite each other.
+   *
+   * @param[in] msg The error message.
+   * @return Pointer to the stored null-terminated message, valid until
+   * the next error of this workspace.
+   */
+  const char *set_error(const std::string &msg) {
+    error_buffer_ = msg;
+    return error_buffer_.c_str();
+  }
+
+  /** Share a variable of another workspace.
+   *
+   * Pushes the variable with the given id of src onto the stack of this
+   * workspace without copying it, so that large read-only data such as
+   * lookup tables can be used by several workspaces. Setting, resizing or
+   * writing the variable with a method of this workspace is rejected, but
+   * the agendas that this workspace executes are not checked. src must
+   * outlive the sharing. Erasing or re-initializing the variable in this
+   * workspace removes the shared reference again, without freeing it.
+   *
+   * @param[in] id Workspace id of the variable to share.
+   * @param[in] src The workspace that holds the variable.
+   */
+  void share_variable(Index id, InteractiveWorkspace &src);
+
+  /** Whether the value of a variable is shared from another workspace.
+   *
+   * @param[in] id Workspace id of the variable.
+   * @return true if the topmost value of the variable was shared with
+   * share_variable.
+   */
+  bool is_shared(Index id);
+
   //! Initialize workspace variable.
   /*!
       If unitialized, initializes the workspace variable. If variable
@@ -308,8 +412,13 @@ class InteractiveWorkspace : private Workspace {
     Remove the stack given by index id from the workspace. This is used by
     the C API to control the workspace size.
 
+    A variable that was created before a workspace started executing and
+    that this workspace holds a value of may be used by the execution, so
+    it cannot be erased until the execution has finished.
+
     \param i Index of the stack to erase.
     \param group_id Index of the group of the variable.
+    \throw std::runtime_error if an executing workspace holds the variable.
     */
   void erase_variable(Index i, Index group_id);
 
@@ -323,7 +432,27 @@ class InteractiveWorkspace : private Workspace {
   void swap(Index i, Index j);
 
  private:
-  
+  /** Marks the workspace as executing for the scope of the object. */
+  class ExecutionScope {
+   public:
+    ExecutionScope(InteractiveWorkspace &ws);
+    ~ExecutionScope();
+    ExecutionScope(const ExecutionScope &) = delete;
+    ExecutionScope &operator=(const ExecutionScope &) = delete;
+
+   private:
+    InteractiveWorkspace &ws_;
+    Index outer_start_;
+  };
+
+  /** Get a variable that is to be overwritten by the C API.
+   *
+   * @param[in] id Workspace id of the variable.
+   * @return Pointer to the variable.
+   * @throw std::runtime_error if the variable is shared.
+   */
+  void *writable_variable(Index id);
+
   /** Resize workspace stack
    *
    * This method resizes the array of stacks that manages the
@@ -331,8 +460,29 @@ class InteractiveWorkspace : private Workspace {
    */
   void resize();
 
+  /** Free all values on the stack of a variable.
+   *
+   * \param i Index of the variable.
+   * \param group_id Index of the group of the variable.
+   */
+  void clear_stack(Index i, Index group_id);
+
+  /** Error message of the last failed call on this workspace. */
+  std::string error_buffer_;
+
+  /** Stamp of the innermost execution that is running, or -1. */
+  Index execution_start_ = -1;
+
   static size_t n_anonymous_variables_;
   static std::vector<Callback *> callbacks_;
+  /** Registry slots of erased variables that can be reused. */
+  static std::vector<Index> free_variables_;
+  /** All interactive workspaces that are alive. */
+  static std::vector<InteractiveWorkspace *> workspaces_;
+  /** Source of the stamps that order executions and added variables. */
+  static std::atomic<Index> n_stamps_;
+  /** Stamp of the addition of each variable, 0 for the built-in ones. */
+  static std::vector<Index> variable_stamps_;
 };
 
 #endif  // _ARTS_INTERACTIVE_WORKSPACE_H_
@@ -34,13 +34,9 @@
 
 #include "linefunctions.h"
 #include <Eigen/Core>
-#include <Faddeeva/Faddeeva.hh>
 #include "constants.h"
 #include "linescaling.h"
 
-/** The Faddeeva function */
-inline Complex w(Complex z) noexcept { return Faddeeva::w(z); }
-
 /** The Faddeeva function partial derivative */
 constexpr Complex dw(Complex z, Complex w) noexcept {
   return Complex(0, 2) * (Constant::inv_sqrt_pi - z * w);
@@ -84,6 +80,35 @@ constexpr Complex pCqSDHC_to_arts_D2_deriv(Complex x) noexcept {
   pow4(c);
 }
 
+/** Adds the far wing of a line outside of its adaptive window
+ * 
+ * The line is continued from its value at the window edge as a Lorentz wing,
+ * so the real part falls as 1/df^2 and the imaginary part as 1/df.  This is
+ * only a correction for the many small wings that add up over a wide grid,
+ * the line itself is below the window threshold here.  The caller limits
+ * the wing to a range around the line, so the cost does not grow with the
+ * size of the grid
+ * 
+ * @param[in,out] sum Accumulated line shape outside of the window
+ * @param[in]     f Frequencies outside of the window
+ * @param[in]     edge Line shape value at the window edge
+ * @param[in]     f_edge Frequency of the window edge
+ * @param[in]     F0 Line center
+ */
+inline void add_far_wing(Eigen::Ref<Eigen::VectorXcd> sum,
+                         const ConstVectorView& f,
+                         const Complex edge,
+                         const Numeric f_edge,
+                         const Numeric F0) noexcept {
+  const Numeric df_edge = f_edge - F0;
+  if (df_edge == 0) return;
+
+  for (Index iv = 0; iv < f.nelem(); iv++) {
+    const Numeric r = df_edge / (f[iv] - F0);
+    sum[iv] += Complex(edge.real() * r * r, edge.imag() * r);
+  }
+}
+
 void Linefunctions::set_lineshape(
     Eigen::Ref<Eigen::VectorXcd> F,
     const Eigen::Ref<const Eigen::VectorXd> f_grid,
@@ -95,7 +120,8 @@ void Linefunctions::set_lineshape(
     const LineShape::Output& X,
     const LineShape::Type lineshape_type,
     const Absorption::MirroringType mirroring_type,
-    const Absorption::NormalizationType norm_type)
+    const Absorption::NormalizationType norm_type,
+    const FaddeevaBlock::Accuracy faddeeva_accuracy)
 {
   Eigen::MatrixXcd dF(0, 0), data(F.size(), Linefunctions::ExpectedDataSize());
 
@@ -104,12 +130,21 @@ void Linefunctions::set_lineshape(
     case LineShape::Type::SDVP:
       set_htp(F,
               dF,
+              data,
               f_grid,
               zeeman_df,
               magnetic_magnitude,
               line.F0(),
               doppler_constant,
-              X);
+              X,
+              AbsorptionLines(),
+              0,
+              ArrayOfRetrievalQuantity(),
+              ArrayOfIndex(),
+              0.0,
+              {0, 0, 0, 0, 0, 0, 0, 0, 0},
+              {0, 0, 0, 0, 0, 0, 0, 0, 0},
+              faddeeva_accuracy);
       break;
     case LineShape::Type::VP:
       set_voigt(F,
@@ -120,7 +155,15 @@ void Linefunctions::set_lineshape(
                 magnetic_magnitude,
                 line.F0(),
                 doppler_constant,
-                X);
+                X,
+                AbsorptionLines(),
+                0,
+                ArrayOfRetrievalQuantity(),
+                ArrayOfIndex(),
+                0.0,
+                {0, 0, 0, 0, 0, 0, 0, 0, 0},
+                {0, 0, 0, 0, 0, 0, 0, 0, 0},
+                faddeeva_accuracy);
       break;
     case LineShape::Type::DP:
       set_doppler(F,
@@ -192,19 +235,36 @@ void Linefunctions::set_lineshape(
                     magnetic_magnitude,
                     -line.F0(),
                     -doppler_constant,
-                    LineShape::mirroredOutput(X));
+                    LineShape::mirroredOutput(X),
+                    AbsorptionLines(),
+                    0,
+                    ArrayOfRetrievalQuantity(),
+                    ArrayOfIndex(),
+                    0.0,
+                    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+                    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+                    faddeeva_accuracy);
           break;
         case LineShape::Type::HTP:
         case LineShape::Type::SDVP:
           // WARNING: This mirroring is not tested and it might require, e.g., FVC to be treated differently
           set_htp(Fm,
                   dF,
+                  data,
                   f_grid,
                   -zeeman_df,
                   magnetic_magnitude,
                   -line.F0(),
                   -doppler_constant,
-                  LineShape::mirroredOutput(X));
+                  LineShape::mirroredOutput(X),
+                  AbsorptionLines(),
+                  0,
+                  ArrayOfRetrievalQuantity(),
+                  ArrayOfIndex(),
+                  0.0,
+                  {0, 0, 0, 0, 0, 0, 0, 0, 0},
+                  {0, 0, 0, 0, 0, 0, 0, 0, 0},
+                  faddeeva_accuracy);
           break;
       }
 
@@ -311,7 +371,8 @@ void Linefunctions::set_voigt(
     const ArrayOfIndex& derivatives_data_position,
     const Numeric& dGD_div_F0_dT,
     const LineShape::Output& dT,
-    const LineShape::Output& dVMR) {
+    const LineShape::Output& dVMR,
+    const FaddeevaBlock::Accuracy faddeeva_accuracy) {
   constexpr Complex iz(0.0, 1.0);
 
   // Size of problem
@@ -334,7 +395,8 @@ void Linefunctions::set_voigt(
   z.noalias() = invGD * (Complex(-F0, lso.G0) + f_grid.array()).matrix();
 
   // Line shape
-  F.noalias() = fac * z.unaryExpr(&w);
+  FaddeevaBlock::w(F, z, faddeeva_accuracy);
+  F *= fac;
 
   if (nppd) {
     dw.noalias() = 2 * (Complex(0, fac * Constant::inv_sqrt_pi) -
@@ -841,6 +903,76 @@ void Linefunctions::find_cutoff_ranges(
   }
 }
 
+Numeric Linefunctions::line_window_halfwidth(const LineShape::Type lineshape_type,
+                                             const Numeric& G0,
+                                             const Numeric& GD,
+                                             const Numeric& threshold) noexcept {
+  using std::abs;
+  using std::log;
+  using std::max;
+  using std::sqrt;
+
+  // Doppler core, exp(-(df/GD)^2) = threshold
+  const Numeric doppler = abs(GD) * sqrt(-log(threshold));
+
+  // Lorentz core, G0^2 / (G0^2 + df^2) = threshold
+  const Numeric lorentz = abs(G0) * sqrt(1 / threshold - 1);
+
+  // Lorentz wing over the Doppler peak, G0 / (pi df^2) = threshold / (sqrt(pi) GD)
+  const Numeric wing = sqrt(abs(G0 * GD) * Constant::inv_sqrt_pi / threshold);
+
+  switch (lineshape_type) {
+    case LineShape::Type::DP:
+      return doppler;
+    case LineShape::Type::LP:
+      return lorentz;
+    case LineShape::Type::VP:
+    case LineShape::Type::HTP:
+    case LineShape::Type::SDVP:
+      return max(max(doppler, lorentz), wing);
+  }
+  return max(max(doppler, lorentz), wing);
+}
+
+void Linefunctions::find_window_range(
+    Index& start,
+    Index& nelem,
+    const ConstVectorView& f_grid,
+    const Numeric& fmin,
+    const Numeric& fmax) noexcept {
+  const Index nf = f_grid.nelem();
+
+  // First position not below fmin
+  Index lo = 0, hi = nf;
+  while (lo < hi) {
+    const Index mid = (lo + hi) / 2;
+    if (f_grid[mid] < fmin)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  start = lo;
+
+  // First position above fmax
+  hi = nf;
+  while (lo < hi) {
+    const Index mid = (lo + hi) / 2;
+    if (f_grid[mid] > fmax)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  nelem = lo - start;
+
+  // Keep the nearest grid point if the window falls between grid points
+  if (nelem == 0 and nf > 0) {
+    if (start == nf or
+        (start > 0 and fmin - f_grid[start - 1] < f_grid[start] - fmax))
+      start--;
+    nelem = 1;
+  }
+}
+
 void Linefunctions::apply_linestrength_from_nlte_level_distributions(
     Eigen::Ref<Eigen::VectorXcd> F,
     Eigen::Ref<Eigen::MatrixXcd> dF,
@@ -930,6 +1062,7 @@ void Linefunctions::apply_linestrength_from_nlte_level_distributions(
 
 void Linefunctions::set_htp(Eigen::Ref<Eigen::VectorXcd> F,
                             Eigen::Ref<Eigen::MatrixXcd> dF,
+                            Eigen::Ref<Eigen::Matrix<Complex, Eigen::Dynamic, ExpectedDataSize()>> data,
                             const Eigen::Ref<const Eigen::VectorXd> f_grid,
                             const Numeric& zeeman_df_si,
                             const Numeric& magnetic_magnitude_si,
@@ -942,7 +1075,8 @@ void Linefunctions::set_htp(Eigen::Ref<Eigen::VectorXcd> F,
                             const ArrayOfIndex& derivatives_data_position,
                             const Numeric& dGD_div_F0_dT_si,
                             const LineShape::Output& dT_si,
-                            const LineShape::Output& dVMR_si) {
+                            const LineShape::Output& dVMR_si,
+                            const FaddeevaBlock::Accuracy faddeeva_accuracy) {
   using Constant::inv_sqrt_pi;
   using Constant::pi;
   using Constant::pow2;
@@ -976,6 +1110,34 @@ void Linefunctions::set_htp(Eigen::Ref<Eigen::VectorXcd> F,
   const Complex Y = pow2(1 / (2 * cte * c2t));
   const Complex sqrtY = sqrt(Y);
 
+  // Naming req data blocks
+  auto W1s = data.col(0);
+  auto W2s = data.col(1);
+
+  // Set the arguments of the Faddeeva function per region so that it can be
+  // evaluated block-wise.  The second argument is Z2 or Zb, or unused as 0
+  for (auto iv = 0; iv < f_grid.size(); iv++) {
+    const Complex X = (iz * (freq2kaycm(f_grid[iv]) - sg0) + c0t) / c2t;
+    const Complex sqrtXY = sqrt(X + Y);
+    const Complex sqrtX = sqrt(X);
+
+    if (abs(c2t) == 0) {
+      W1s[iv] = iz * ((iz * (freq2kaycm(f_grid[iv]) - sg0) + c0t) * cte);
+      W2s[iv] = 0;
+    } else if (abs(X) <= 3e-8 * abs(Y)) {
+      W1s[iv] = iz * ((iz * (freq2kaycm(f_grid[iv]) - sg0) + c0t) * cte);
+      W2s[iv] = iz * (sqrtXY + sqrtY);
+    } else if (abs(Y) <= 1e-15 * abs(X)) {
+      W1s[iv] = iz * sqrtXY;
+      W2s[iv] = (abs(sqrtX) <= 4e3) ? iz * sqrtX : 0;
+    } else {
+      W1s[iv] = iz * (sqrtXY - sqrtY);
+      W2s[iv] = iz * (sqrtXY + sqrtY);
+    }
+  }
+  FaddeevaBlock::w(W1s, W1s, faddeeva_accuracy);
+  if (abs(c2t) not_eq 0) FaddeevaBlock::w(W2s, W2s, faddeeva_accuracy);
+
   // For all frequencies
   for (auto iv = 0; iv < f_grid.size(); iv++) {
     const Complex X = (iz * (freq2kaycm(f_grid[iv]) - sg0) + c0t) / c2t;
@@ -988,7 +1150,7 @@ void Linefunctions::set_htp(Eigen::Ref<Eigen::VectorXcd> F,
     if (abs(c2t) ==
         0) {  // If this method does not require G2, D2, or ETA==1, then FVC matters.
       Z1 = (iz * (freq2kaycm(f_grid[iv]) - sg0) + c0t) * cte;
-      W1 = w(iz * Z1);
+      W1 = W1s[iv];
 
       Aterm = sqrt_pi * cte * W1;
       if (abs(Z1) <=
@@ -1003,8 +1165,8 @@ void Linefunctions::set_htp(Eigen::Ref<Eigen::VectorXcd> F,
       Z1 = (iz * (freq2kaycm(f_grid[iv]) - sg0) + c0t) * cte;
       Z2 = sqrtXY + sqrtY;
 
-      W1 = w(iz * Z1);
-      W2 = w(iz * Z2);
+      W1 = W1s[iv];
+      W2 = W2s[iv];
 
       Aterm = sqrt_pi * cte * (W1 - W2);
       Bterm = (-1 + sqrt_pi / (2 * sqrtY) * (1 - pow2(Z1)) * W1 -
@@ -1016,11 +1178,11 @@ void Linefunctions::set_htp(Eigen::Ref<Eigen::VectorXcd> F,
             abs(X)) {  // If this method is executed very far from the line center
       Z1 = sqrtXY;
 
-      W1 = w(iz * Z1);
+      W1 = W1s[iv];
 
       if (abs(sqrtX) <= 4e3) {  // If X is small still
         Zb = sqrtX;
-        Wb = w(iz * Zb);
+        Wb = W2s[iv];
 
         Aterm = (2 * sqrt_pi / c2t) * (inv_sqrt_pi - sqrtX * Wb);
         Bterm =
@@ -1037,8 +1199,8 @@ void Linefunctions::set_htp(Eigen::Ref<Eigen::VectorXcd> F,
       Z2 = Z1 + 2 * sqrtY;
 
       // NOTE: the region of w might matter according to original code!  So this might need changing...
-      W1 = w(iz * Z1);
-      W2 = w(iz * Z2);
+      W1 = W1s[iv];
+      W2 = W2s[iv];
 
       Aterm = sqrt_pi * cte * (W1 - W2);
       Bterm = (-1 + sqrt_pi / (2 * sqrtY) * (1 - pow2(Z1)) * W1 -
@@ -1293,6 +1455,8 @@ void Linefunctions::set_cross_section_of_band(
     InternalData& sum,
     const ConstVectorView f_grid,
     const AbsorptionLines& band,
+    const Absorption::LinesHotView& hotview,
+    const ArrayOfIndex& lines,
     const ArrayOfRetrievalQuantity& derivatives_data,
     const ArrayOfIndex& derivatives_data_active,
     const Vector& vmrs,
@@ -1308,7 +1472,9 @@ void Linefunctions::set_cross_section_of_band(
     const Numeric& QT0,
     const bool no_negatives,
     const bool zeeman,
-    const Zeeman::Polarization zeeman_polarization)
+    const Zeeman::Polarization zeeman_polarization,
+    const FaddeevaBlock::Accuracy faddeeva_accuracy,
+    const Numeric line_window_threshold)
 {
   const Index nj = derivatives_data_active.nelem();
   const bool do_temperature = do_temperature_jacobian(derivatives_data);
@@ -1316,7 +1482,7 @@ void Linefunctions::set_cross_section_of_band(
   // Sum up variable reset
   sum.SetZero();
   
-  if (band.NumLines() == 0 or (Absorption::relaxationtype_relmat(band.Population()) and band.LinemixingLimit() > P)) {
+  if (lines.nelem() == 0 or (Absorption::relaxationtype_relmat(band.Population()) and band.LinemixingLimit() > P)) {
     return;  // No line-by-line computations required/wanted
   }
   
@@ -1335,37 +1501,40 @@ void Linefunctions::set_cross_section_of_band(
   const Numeric fmean = (band.Cutoff() == Absorption::CutoffType::BandFixedFrequency) ? band.F_mean() : 0;
   Numeric fcut_upp, fcut_low;
   Index start, nelem;
-  fcut_upp = band.CutoffFreq(0);
-  fcut_low = band.CutoffFreqMinus(0, fmean);
+  fcut_upp = band.CutoffFreq(lines[0]);
+  fcut_low = band.CutoffFreqMinus(lines[0], fmean);
   find_cutoff_ranges(start, nelem, f_full, fcut_low, fcut_upp);
   fc[0] = fcut_upp;
   
+  // Adaptive line windows are only used when the band has no cutoff
+  const bool do_window = line_window_threshold > 0 and
+                         band.Cutoff() == Absorption::CutoffType::None;
+  const bool do_far_wing =
+      do_window and band.LineShapeType() not_eq LineShape::Type::DP;
+
   // VMR Jacobian check
   auto do_vmr = do_vmr_jacobian(derivatives_data, band.QuantumIdentity());
   
   // Placeholder nothingness
   constexpr LineShape::Output empty_output = {0, 0, 0, 0, 0, 0, 0, 0, 0};
   
-  for (Index i=0; i<band.NumLines(); i++) {
+  // Pressure broadening and line mixing terms of all lines
+  hotview.ShapeParameters(scratch.X, T, P, vmrs, lines);
+  
+  for (Index il=0; il<lines.nelem(); il++) {
+    const Index i = lines[il];
+    const Numeric F0 = hotview.F0(i);
     
     // Select the range of cutoff if different for each line
-    if (band.Cutoff() == Absorption::CutoffType::LineByLineOffset and i>0) {
+    if (band.Cutoff() == Absorption::CutoffType::LineByLineOffset and il>0) {
       fcut_upp = band.CutoffFreq(i);
       fcut_low = band.CutoffFreqMinus(i, fmean);
       find_cutoff_ranges(start, nelem, f_full, fcut_low, fcut_upp);
       fc[0] = fcut_upp;
     }
     
-    // Relevant range FIXME: By Band and no-cutoff does not need this...
-    auto F = scratch.F.segment(start, nelem);
-    auto N = scratch.N.segment(start, nelem);
-    auto dF = scratch.dF.middleRows(start, nelem);
-    auto dN = scratch.dN.middleRows(start, nelem);
-    auto data = scratch.data.middleRows(start, nelem);
-    const auto f = f_full.middleRows(start, nelem);
-    
     // Pressure broadening and line mixing terms
-    const auto X = band.ShapeParameters(i, T, P, vmrs);
+    const auto& X = scratch.X[il];
     
     // Partial derivatives for temperature
     const auto dXdT = do_temperature ?
@@ -1387,28 +1556,44 @@ void Linefunctions::set_cross_section_of_band(
       const Numeric dfdH = zeeman ?
         band.ZeemanSplitting(i, zeeman_polarization, iz) : 0;
       
+      // Select the adaptive window of this line
+      const Numeric F0_window = F0 + X.D0 + X.DV + dfdH * H;
+      Numeric df_window = 0;
+      if (do_window) {
+        df_window = line_window_halfwidth(band.LineShapeType(), X.G0, DC * F0_window, line_window_threshold);
+        find_window_range(start, nelem, f_grid, F0_window - df_window, F0_window + df_window);
+      }
+      
+      // Relevant range FIXME: By Band and no-cutoff does not need this...
+      auto F = scratch.F.segment(start, nelem);
+      auto N = scratch.N.segment(start, nelem);
+      auto dF = scratch.dF.middleRows(start, nelem);
+      auto dN = scratch.dN.middleRows(start, nelem);
+      auto data = scratch.data.middleRows(start, nelem);
+      const auto f = f_full.middleRows(start, nelem);
+      
       // Set the line shape and its derivatives
       switch (band.LineShapeType()) {
         case LineShape::Type::DP:
-          set_doppler(F, dF, data, f, dfdH, H, band.F0(i), DC, band, i, derivatives_data, derivatives_data_active, dDCdT);
+          set_doppler(F, dF, data, f, dfdH, H, F0, DC, band, i, derivatives_data, derivatives_data_active, dDCdT);
           if (band.Cutoff() not_eq Absorption::CutoffType::None)
-            set_doppler(Fc, dFc, datac, fc, dfdH, H, band.F0(i), DC, band, i, derivatives_data, derivatives_data_active, dDCdT);
+            set_doppler(Fc, dFc, datac, fc, dfdH, H, F0, DC, band, i, derivatives_data, derivatives_data_active, dDCdT);
           break;
         case LineShape::Type::HTP:
         case LineShape::Type::SDVP:
-          set_htp(F, dF, f, dfdH, H, band.F0(i), DC, X, band, i, derivatives_data, derivatives_data_active, dDCdT, dXdT, dXdVMR);
+          set_htp(F, dF, data, f, dfdH, H, F0, DC, X, band, i, derivatives_data, derivatives_data_active, dDCdT, dXdT, dXdVMR, faddeeva_accuracy);
           if (band.Cutoff() not_eq Absorption::CutoffType::None)
-            set_htp(Fc, dFc, fc, dfdH, H, band.F0(i), DC, X, band, i, derivatives_data, derivatives_data_active, dDCdT, dXdT, dXdVMR);
+            set_htp(Fc, dFc, datac, fc, dfdH, H, F0, DC, X, band, i, derivatives_data, derivatives_data_active, dDCdT, dXdT, dXdVMR, faddeeva_accuracy);
           break;
         case LineShape::Type::LP:
-          set_lorentz(F, dF, data, f, dfdH, H, band.F0(i), X, band, i, derivatives_data, derivatives_data_active, dXdT, dXdVMR);
+          set_lorentz(F, dF, data, f, dfdH, H, F0, X, band, i, derivatives_data, derivatives_data_active, dXdT, dXdVMR);
           if (band.Cutoff() not_eq Absorption::CutoffType::None)
-            set_lorentz(Fc, dFc, datac, fc, dfdH, H, band.F0(i), X, band, i, derivatives_data, derivatives_data_active, dXdT, dXdVMR);
+            set_lorentz(Fc, dFc, datac, fc, dfdH, H, F0, X, band, i, derivatives_data, derivatives_data_active, dXdT, dXdVMR);
           break;
         case LineShape::Type::VP:
-          set_voigt(F, dF, data, f, dfdH, H, band.F0(i), DC, X, band, i, derivatives_data, derivatives_data_active, dDCdT, dXdT, dXdVMR);
+          set_voigt(F, dF, data, f, dfdH, H, F0, DC, X, band, i, derivatives_data, derivatives_data_active, dDCdT, dXdT, dXdVMR, faddeeva_accuracy);
           if (band.Cutoff() not_eq Absorption::CutoffType::None)
-            set_voigt(Fc, dFc, datac, fc, dfdH, H, band.F0(i), DC, X, band, i, derivatives_data, derivatives_data_active, dDCdT, dXdT, dXdVMR);
+            set_voigt(Fc, dFc, datac, fc, dfdH, H, F0, DC, X, band, i, derivatives_data, derivatives_data_active, dDCdT, dXdT, dXdVMR, faddeeva_accuracy);
           break;
       }
       
@@ -1429,33 +1614,33 @@ void Linefunctions::set_cross_section_of_band(
         case Absorption::MirroringType::Manual:
           break;
         case Absorption::MirroringType::Lorentz:
-          set_lorentz(N, dN, data, f, -dfdH, H, -band.F0(i), LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
+          set_lorentz(N, dN, data, f, -dfdH, H, -F0, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
           if (band.Cutoff() not_eq Absorption::CutoffType::None)
-            set_lorentz(Nc, dNc, datac, fc, -dfdH, H, -band.F0(i), LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
+            set_lorentz(Nc, dNc, datac, fc, -dfdH, H, -F0, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
           break;
         case Absorption::MirroringType::SameAsLineShape:
           switch (band.LineShapeType()) {
             case LineShape::Type::DP:
-              set_doppler(N, dN, data, f, -dfdH, H, -band.F0(i), -DC, band, i, derivatives_data, derivatives_data_active, -dDCdT);
+              set_doppler(N, dN, data, f, -dfdH, H, -F0, -DC, band, i, derivatives_data, derivatives_data_active, -dDCdT);
               if (band.Cutoff() not_eq Absorption::CutoffType::None)
-                set_doppler(Nc, dNc, datac, fc, -dfdH, H, -band.F0(i), -DC, band, i, derivatives_data, derivatives_data_active, -dDCdT);
+                set_doppler(Nc, dNc, datac, fc, -dfdH, H, -F0, -DC, band, i, derivatives_data, derivatives_data_active, -dDCdT);
               break;
             case LineShape::Type::LP:
-              set_lorentz(N, dN, data, f, -dfdH, H, -band.F0(i), LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
+              set_lorentz(N, dN, data, f, -dfdH, H, -F0, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
               if (band.Cutoff() not_eq Absorption::CutoffType::None)
-                set_lorentz(Nc, dNc, datac, fc, -dfdH, H, -band.F0(i), LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
+                set_lorentz(Nc, dNc, datac, fc, -dfdH, H, -F0, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
               break;
             case LineShape::Type::VP:
-              set_voigt(N, dN, data, f, -dfdH, H, -band.F0(i), -DC, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, -dDCdT, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
+              set_voigt(N, dN, data, f, -dfdH, H, -F0, -DC, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, -dDCdT, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output, faddeeva_accuracy);
               if (band.Cutoff() not_eq Absorption::CutoffType::None)
-                set_voigt(Nc, dNc, datac, fc, -dfdH, H, -band.F0(i), -DC, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, -dDCdT, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
+                set_voigt(Nc, dNc, datac, fc, -dfdH, H, -F0, -DC, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, -dDCdT, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output, faddeeva_accuracy);
               break;
             case LineShape::Type::HTP:
             case LineShape::Type::SDVP:
               // WARNING: This mirroring is not tested and it might require, e.g., FVC to be treated differently
-              set_htp(N, dN, f, -dfdH, H, -band.F0(i), -DC, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, -dDCdT, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
+              set_htp(N, dN, data, f, -dfdH, H, -F0, -DC, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, -dDCdT, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output, faddeeva_accuracy);
               if (band.Cutoff() not_eq Absorption::CutoffType::None)
-                set_htp(Nc, dNc, fc, -dfdH, H, -band.F0(i), -DC, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, -dDCdT, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output);
+                set_htp(Nc, dNc, datac, fc, -dfdH, H, -F0, -DC, LineShape::mirroredOutput(X), band, i, derivatives_data, derivatives_data_active, -dDCdT, do_temperature ? LineShape::mirroredOutput(dXdT) : empty_output, do_vmr.test ? LineShape::mirroredOutput(dXdVMR) : empty_output, faddeeva_accuracy);
               break;
           }
           break;
@@ -1482,13 +1667,13 @@ void Linefunctions::set_cross_section_of_band(
         case Absorption::NormalizationType::None:
           break;
         case Absorption::NormalizationType::VVH:
-          apply_VVH_scaling(F, dF, data, f, band.F0(i), T, band, i, derivatives_data, derivatives_data_active);
+          apply_VVH_scaling(F, dF, data, f, F0, T, band, i, derivatives_data, derivatives_data_active);
           break;
         case Absorption::NormalizationType::VVW:
-          apply_VVW_scaling(F, dF, f, band.F0(i), band, i, derivatives_data, derivatives_data_active);
+          apply_VVW_scaling(F, dF, f, F0, band, i, derivatives_data, derivatives_data_active);
           break;
         case Absorption::NormalizationType::RosenkranzQuadratic:
-          apply_rosenkranz_quadratic_scaling(F, dF, f, band.F0(i), T, band, i, derivatives_data, derivatives_data_active);
+          apply_rosenkranz_quadratic_scaling(F, dF, f, F0, T, band, i, derivatives_data, derivatives_data_active);
           break;
       }
 
@@ -1505,7 +1690,7 @@ void Linefunctions::set_cross_section_of_band(
         } break;
         case Absorption::PopulationType::ByNLTEPopulationDistribution: {
           auto nlte_data = nlte.get_ratio_params(band, i);
-          apply_linestrength_from_nlte_level_distributions(F, dF, N, dN, nlte_data.r_low, nlte_data.r_upp, band.g_low(i), band.g_upp(i), band.A(i), band.F0(i), T, band, i, derivatives_data, derivatives_data_active);
+          apply_linestrength_from_nlte_level_distributions(F, dF, N, dN, nlte_data.r_low, nlte_data.r_upp, band.g_low(i), band.g_upp(i), band.A(i), F0, T, band, i, derivatives_data, derivatives_data_active);
         } break;
       }
       
@@ -1522,6 +1707,32 @@ void Linefunctions::set_cross_section_of_band(
       sum.N.segment(start, nelem).noalias() += N;
       sum.dF.middleRows(start, nelem).noalias() += dF;
       sum.dN.middleRows(start, nelem).noalias() += dN;
+      
+      // Continue the line outside of its window as a far wing, until its
+      // real part has fallen to the threshold of the edge value.  The wing
+      // is an approximation of the absorption only, the partial derivatives
+      // are kept to the window
+      if (do_far_wing and nelem) {
+        const Numeric df_wing = df_window / std::sqrt(line_window_threshold);
+        Index wstart, wnelem;
+        find_window_range(wstart, wnelem, f_grid, F0_window - df_wing, F0_window + df_wing);
+        const Index nlow = std::max<Index>(start - wstart, 0);
+        const Index nupp = std::max<Index>(wstart + wnelem - start - nelem, 0);
+        const Numeric flow = f_grid[start];
+        const Numeric fupp = f_grid[start + nelem - 1];
+        
+        if (nlow) {
+          const ConstVectorView fw = f_grid[Range(start - nlow, nlow)];
+          add_far_wing(sum.F.segment(start - nlow, nlow), fw, F[0], flow, F0_window);
+          add_far_wing(sum.N.segment(start - nlow, nlow), fw, N[0], flow, F0_window);
+        }
+        
+        if (nupp) {
+          const ConstVectorView fw = f_grid[Range(start + nelem, nupp)];
+          add_far_wing(sum.F.segment(start + nelem, nupp), fw, F[nelem - 1], fupp, F0_window);
+          add_far_wing(sum.N.segment(start + nelem, nupp), fw, N[nelem - 1], fupp, F0_window);
+        }
+      }
     }
   }
   
@@ -32,6 +32,7 @@
 
 #include "complex.h"
 #include "energylevelmap.h"
+#include "faddeeva_block.h"
 #include "jacobian.h"
 #include "absorptionlines.h"
 
@@ -55,6 +56,7 @@ constexpr Index ExpectedDataSize() { return 2; }
  * @param[in]     lineshape_type Line shape scheme
  * @param[in]     mirroring_type Mirroring scheme
  * @param[in]     norm_type Normalization scheme
+ * @param[in]     faddeeva_accuracy Accuracy tier of the Faddeeva function
  */
 void set_lineshape(Eigen::Ref<Eigen::VectorXcd> F,
                    const Eigen::Ref<const Eigen::VectorXd> f_grid,
@@ -66,7 +68,9 @@ void set_lineshape(Eigen::Ref<Eigen::VectorXcd> F,
                    const LineShape::Output& lso,
                    const LineShape::Type lineshape_type,
                    const Absorption::MirroringType mirroring_type,
-                   const Absorption::NormalizationType norm_type);
+                   const Absorption::NormalizationType norm_type,
+                   const FaddeevaBlock::Accuracy faddeeva_accuracy =
+                       FaddeevaBlock::Accuracy::Exact);
 
 /** Sets the Lorentz line shape. Normalization is unity.
  * 
@@ -110,6 +114,7 @@ void set_lorentz(
  * 
  * @param[in,out] F Lineshape.  Must be right size
  * @param[in,out] dF Lineshape derivative.  Must be right size
+ * @param[in,out] data Block of allocated memory.  Output nonsensical
  * @param[in]     f_grid Frequency grid of computations
  * @param[in]     zeeman_df Zeeman shift parameter for the line
  * @param[in]     magnetic_magnitude Absolute strength of the magnetic field
@@ -123,9 +128,11 @@ void set_lorentz(
  * @param[in]     dGD_div_F0_dT Temperature derivative of GD_div_F0
  * @param[in]     dT Temperature derivatives of line shape parameters
  * @param[in]     dVMR VMR derivatives of line shape parameters
+ * @param[in]     faddeeva_accuracy Accuracy tier of the Faddeeva function
  */
 void set_htp(Eigen::Ref<Eigen::VectorXcd> F,
              Eigen::Ref<Eigen::MatrixXcd> dF,
+             Eigen::Ref<Eigen::Matrix<Complex, Eigen::Dynamic, ExpectedDataSize()>> data,
              const Eigen::Ref<const Eigen::VectorXd> f_grid,
              const Numeric& zeeman_df,
              const Numeric& magnetic_magnitude,
@@ -139,7 +146,9 @@ void set_htp(Eigen::Ref<Eigen::VectorXcd> F,
              const ArrayOfIndex& derivatives_data_position = ArrayOfIndex(),
              const Numeric& dGD_div_F0_dT = 0.0,
              const LineShape::Output& dT = {0, 0, 0, 0, 0, 0, 0, 0, 0},
-             const LineShape::Output& dVMR = {0, 0, 0, 0, 0, 0, 0, 0, 0});
+             const LineShape::Output& dVMR = {0, 0, 0, 0, 0, 0, 0, 0, 0},
+             const FaddeevaBlock::Accuracy faddeeva_accuracy =
+                 FaddeevaBlock::Accuracy::Exact);
 
 /** Sets the Voigt line shape. Normalization is unity.
  * 
@@ -159,6 +168,7 @@ void set_htp(Eigen::Ref<Eigen::VectorXcd> F,
  * @param[in]     dGD_div_F0_dT Temperature derivative of GD_div_F0
  * @param[in]     dT Temperature derivatives of line shape parameters
  * @param[in]     dVMR VMR derivatives of line shape parameters
+ * @param[in]     faddeeva_accuracy Accuracy tier of the Faddeeva function
  */
 void set_voigt(
     Eigen::Ref<Eigen::VectorXcd> F,
@@ -177,7 +187,9 @@ void set_voigt(
     const ArrayOfIndex& derivatives_data_position = ArrayOfIndex(),
     const Numeric& dGD_div_F0_dT = 0.0,
     const LineShape::Output& dT = {0, 0, 0, 0, 0, 0, 0, 0, 0},
-    const LineShape::Output& dVMR = {0, 0, 0, 0, 0, 0, 0, 0, 0});
+    const LineShape::Output& dVMR = {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    const FaddeevaBlock::Accuracy faddeeva_accuracy =
+        FaddeevaBlock::Accuracy::Exact);
 
 /** Sets the Doppler line shape. Normalization is unity.
  * 
@@ -474,6 +486,43 @@ void find_cutoff_ranges(Index& start_cutoff,
                         const Numeric& fmin,
                         const Numeric& fmax);
 
+/** Returns the half-width of the adaptive evaluation window of a line
+ * 
+ * The window covers the frequencies where the line shape is above threshold
+ * times its peak value.  For Voigt-like line shapes it is the largest of the
+ * Doppler core, the Lorentz core, and the Lorentz wing over the Doppler peak,
+ * so it is conservative for any ratio of the two widths
+ * 
+ * @param[in]     lineshape_type Line shape scheme
+ * @param[in]     G0 Pressure broadening half-width
+ * @param[in]     GD Doppler half-width (at 1/e of the peak)
+ * @param[in]     threshold Relative threshold, 0 < threshold < 1
+ * 
+ * @return Half-width of the window
+ */
+Numeric line_window_halfwidth(const LineShape::Type lineshape_type,
+                              const Numeric& G0,
+                              const Numeric& GD,
+                              const Numeric& threshold) noexcept;
+
+/** Sets the frequency indices of the adaptive window of a line
+ * 
+ * Same as find_cutoff_ranges but by bisection and always returning at
+ * least the grid point nearest to the window, so that the far wing of lines
+ * between or outside the grid points can be scaled from an evaluated point
+ * 
+ * @param[out]    start Start pos of the window
+ * @param[out]    nelem Number of frequencies in the window
+ * @param[in]     f_grid Frequency grid of computations.  Must be sorted
+ * @param[in]     fmin Minimum frequency
+ * @param[in]     fmax Maximum frequency
+ */
+void find_window_range(Index& start,
+                       Index& nelem,
+                       const ConstVectorView& f_grid,
+                       const Numeric& fmin,
+                       const Numeric& fmax) noexcept;
+
 /** Applies non-lte linestrength to already set line shape
  * 
  * Works on ratio-inputs, meaning that the total distribution does not have to be known
@@ -530,6 +579,8 @@ public:
   Eigen::Matrix<Complex, Eigen::Dynamic, Linefunctions::ExpectedDataSize()> data;
   Eigen::Matrix<Complex, 1, Linefunctions::ExpectedDataSize()> datac;
   
+  std::vector<LineShape::Output> X;
+  
   InternalData(Index nf, Index nj) {
     F.setZero(nf);
     N.setZero(nf);
@@ -558,6 +609,8 @@ public:
  * @param[in,out] sun Data that is set to zero then added onto by every line
  * @param[in] f_grid As WSV
  * @param[in] band The absorption band
+ * @param[in] hotview The hot view of the band, see Absorption::Lines::HotView
+ * @param[in] lines Indices of the lines of the band to compute
  * @param[in] derivatives_data Derivatives
  * @param[in] derivatives_data_active Derivatives that are active
  * @param[in] vmrs The VMRs of this band's broadening species
@@ -574,12 +627,16 @@ public:
  * @param[in] no_negatives Check sum.F before output of any real negative values, and removes them if present
  * @param[in] zeeman Attempts adding up the fine Zeeman lines
  * @param[in] zeeman_polarization The polarization of Zeeman model (to know how many Zeeman lines there will be)
+ * @param[in] faddeeva_accuracy Accuracy tier of the Faddeeva function
+ * @param[in] line_window_threshold If positive, and the band has no cutoff, each line is only evaluated where it is above this fraction of its peak, and a far-wing correction is added to the absorption (not to its derivatives) up to where the wing falls to this fraction of its edge value
  */
 void set_cross_section_of_band(
   InternalData& scratch,
   InternalData& sum,
   const ConstVectorView f_grid,
   const AbsorptionLines& band,
+  const Absorption::LinesHotView& hotview,
+  const ArrayOfIndex& lines,
   const ArrayOfRetrievalQuantity& derivatives_data,
   const ArrayOfIndex& derivatives_data_active,
   const Vector& vmrs,
@@ -595,7 +652,9 @@ void set_cross_section_of_band(
   const Numeric& QT0,
   const bool no_negatives=false,
   const bool zeeman=false,
-  const Zeeman::Polarization zeeman_polarization=Zeeman::Polarization::Pi);
+  const Zeeman::Polarization zeeman_polarization=Zeeman::Polarization::Pi,
+  const FaddeevaBlock::Accuracy faddeeva_accuracy=FaddeevaBlock::Accuracy::Exact,
+  const Numeric line_window_threshold=0);
 };  // namespace Linefunctions
 
 #endif  //linefunctions_h
@@ -355,47 +355,81 @@ constexpr Index nmaxTempModelParams = 4;
 /** Current max number of line shape variables */
 constexpr Index nVars = 9;
 
+/** Line mixing as done by AER data in ARTS
+ * 
+ * Uses piece-wise linear interpolation and extrapolates at the edges
+ * 
+ * @param[in] T The temperature
+ * @param[in] mp The coefficients
+ * 
+ * @return The broadening parameter at temperature
+ */
+constexpr Numeric special_linemixing_aer(Numeric T, ModelParameters mp) noexcept {
+  if (T < 250)
+    return mp.X0 + (T - 200) * (mp.X1 - mp.X0) / (250 - 200);
+  else if (T > 296)
+    return mp.X2 + (T - 296) * (mp.X3 - mp.X2) / (340 - 296);
+  else
+    return mp.X1 + (T - 250) * (mp.X2 - mp.X1) / (296 - 250);
+}
+
+/** The temperature derivative of special_linemixing_aer
+ * 
+ * @param[in] T The temperature
+ * @param[in] mp The coefficients
+ * 
+ * @return The temperature derivative of the broadening parameter at temperature
+ */
+constexpr Numeric special_linemixing_aer_dT(Numeric T, ModelParameters mp) noexcept {
+  if (T < 250)
+    return (mp.X1 - mp.X0) / (250 - 200);
+  else if (T > 296)
+    return (mp.X3 - mp.X2) / (340 - 296);
+  else
+    return (mp.X2 - mp.X1) / (296 - 250);
+}
+
+/** Compute a variable from its coefficients and temperature model
+ * 
+ * @param[in] mp The coefficients and temperature model
+ * @param[in] T The temperature
+ * @param[in] T0 The temperature used to derive the coefficients
+ * 
+ * @return The variable at temperature
+ */
+inline Numeric compute_model(const ModelParameters& mp, Numeric T, Numeric T0) noexcept {
+  using std::log;
+  using std::pow;
+  
+  Numeric out=std::numeric_limits<Numeric>::quiet_NaN();
+  switch (mp.type) {
+    case TemperatureModel::None:
+      out = 0; break;
+    case TemperatureModel::T0:
+      out = mp.X0; break;
+    case TemperatureModel::T1:
+      out = mp.X0 * pow(T0 / T, mp.X1); break;
+    case TemperatureModel::T2:
+      out = mp.X0 * pow(T0 / T, mp.X1) * (1 + mp.X2 * log(T / T0)); break;
+    case TemperatureModel::T3:
+      out = mp.X0 + mp.X1 * (T - T0); break;
+    case TemperatureModel::T4:
+      out = (mp.X0 + mp.X1 * (T0 / T - 1.)) * pow(T0 / T, mp.X2); break;
+    case TemperatureModel::T5:
+      out = mp.X0 * pow(T0 / T, 0.25 + 1.5 * mp.X1); break;
+    case TemperatureModel::LM_AER:
+      out = special_linemixing_aer(T, mp); break;
+    case TemperatureModel::DPL:
+      out = mp.X0 * pow(T0 / T, mp.X1) + mp.X2 * pow(T0 / T, mp.X3); break;
+  }
+  return out;
+}
+
 /** Compute the line shape parameters for a single broadening species */
 class SingleSpeciesModel {
  private:
   std::array<ModelParameters, nVars> X;
 
-  /** Line mixing as done by AER data in ARTS
-   * 
-   * Uses piece-wise linear interpolation and extrapolates at the edges
-   * 
-   * var must be G or Y
-   * 
-   * @param[in] T The temperature
-   * @param[in] var The variable
-   * 
-   * @return The broadening parameter at temperature
-   */
-  constexpr Numeric special_linemixing_aer(Numeric T, ModelParameters mp) const noexcept {
-    if (T < 250)
-      return mp.X0 + (T - 200) * (mp.X1 - mp.X0) / (250 - 200);
-    else if (T > 296)
-      return mp.X2 + (T - 296) * (mp.X3 - mp.X2) / (340 - 296);
-    else
-      return mp.X1 + (T - 250) * (mp.X2 - mp.X1) / (296 - 250);
-  }
-  
-  /** The temperature derivative of special_linemixing_aer
-   * 
-   * @param[in] T The temperature
-   * @param[in] var The variable
-   * 
-   * @return The temperature derivative of the broadening parameter at temperature
-   */
-  constexpr Numeric special_linemixing_aer_dT(Numeric T, ModelParameters mp) const noexcept {
-    if (T < 250)
-      return (mp.X1 - mp.X0) / (250 - 200);
-    else if (T > 296)
-      return (mp.X3 - mp.X2) / (340 - 296);
-    else
-      return (mp.X2 - mp.X1) / (296 - 250);
-  }
-
  public:
   /** Default initialization */
   constexpr SingleSpeciesModel(
@@ -424,31 +458,7 @@ class SingleSpeciesModel {
  * @return The broadening parameter at temperature
  */
 Numeric compute(Numeric T, Numeric T0, Variable var) const noexcept {
-  using std::log;
-  using std::pow;
-  
-  Numeric out=std::numeric_limits<Numeric>::quiet_NaN();
-  switch (X[Index(var)].type) {
-    case TemperatureModel::None:
-      out = 0; break;
-    case TemperatureModel::T0:
-      out = x0; break;
-    case TemperatureModel::T1:
-      out = x0 * pow(T0 / T, x1); break;
-    case TemperatureModel::T2:
-      out = x0 * pow(T0 / T, x1) * (1 + x2 * log(T / T0)); break;
-    case TemperatureModel::T3:
-      out = x0 + x1 * (T - T0); break;
-    case TemperatureModel::T4:
-      out = (x0 + x1 * (T0 / T - 1.)) * pow(T0 / T, x2); break;
-    case TemperatureModel::T5:
-      out = x0 * pow(T0 / T, 0.25 + 1.5 * x1); break;
-    case TemperatureModel::LM_AER:
-      out = special_linemixing_aer(T, X[Index(var)]); break;
-    case TemperatureModel::DPL:
-      out = x0 * pow(T0 / T, x1) + x2 * pow(T0 / T, x3); break;
-  }
-  return out;
+  return compute_model(X[Index(var)], T, T0);
 }
 
 /** Derivative of compute(...) wrt x0
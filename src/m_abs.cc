@@ -1771,6 +1771,8 @@ void abs_xsec_per_speciesAddLines(
     const SpeciesAuxData& isotopologue_ratios,
     const SpeciesAuxData& partition_functions,
     const Index& lbl_checked,
+    const String& faddeeva_accuracy,
+    const Numeric& line_window_threshold,
     const Verbosity&) {
   if (not abs_lines_per_species.nelem()) return;
   
@@ -1785,6 +1787,13 @@ void abs_xsec_per_speciesAddLines(
     throw std::runtime_error(os.str());
   }
 
+  if (line_window_threshold < 0 or line_window_threshold >= 1) {
+    std::ostringstream os;
+    os << "The line window threshold must be in [0, 1), but it is "
+       << line_window_threshold << '\n';
+    throw std::runtime_error(os.str());
+  }
+
   // Check that all parameters that should have the number of tag
   // groups as a dimension are consistent.
   {
@@ -1806,6 +1815,7 @@ void abs_xsec_per_speciesAddLines(
 
   // Meta variables that explain the calculations required
   const ArrayOfIndex jac_pos = equivalent_propmattype_indexes(jacobian_quantities);
+  const auto accuracy = FaddeevaBlock::string2accuracy(faddeeva_accuracy);
 
   // Skipping uninteresting data
   static Matrix dummy1(0, 0);
@@ -1837,7 +1847,9 @@ void abs_xsec_per_speciesAddLines(
           lines,
           isotopologue_ratios.getIsotopologueRatio(lines.QuantumIdentity()),
           partition_functions.getParamType(lines.QuantumIdentity()),
-          partition_functions.getParam(lines.QuantumIdentity()));
+          partition_functions.getParam(lines.QuantumIdentity()),
+          accuracy,
+          line_window_threshold);
     }
   }  // End of species for loop.
 }
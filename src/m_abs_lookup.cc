@@ -24,8 +24,12 @@
 */
 
 #include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
 #include <limits>
 #include <map>
+#include <unistd.h>
 
 #include "absorption.h"
 #include "agenda_class.h"
@@ -34,6 +38,7 @@
 #include "auto_md.h"
 #include "check_input.h"
 #include "cloudbox.h"
+#include "file.h"
 #include "gas_abs_lookup.h"
 #include "global_data.h"
 #include "interpolation_poly.h"
@@ -42,6 +47,7 @@
 #include "messages.h"
 #include "physics_funcs.h"
 #include "rng.h"
+#include "xml_io.h"
 
 extern const Index GFIELD4_FIELD_NAMES;
 extern const Index GFIELD4_P_GRID;
@@ -56,6 +62,249 @@ void abs_lookupInit(GasAbsLookup& x, const Verbosity& verbosity) {
   out2 << "  Created an empty gas absorption lookup table.\n";
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void abs_lookupReadMapped(GasAbsLookup& abs_lookup,
+                          const String& filename,
+                          const Verbosity& verbosity) {
+  abs_lookup.ReadMapped(filename, verbosity);
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void abs_lookupSetStorage(GasAbsLookup& abs_lookup,
+                          const String& storage,
+                          const Verbosity& verbosity) {
+  abs_lookup.SetStorage(string2lookupstorage(storage), verbosity);
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void abs_lookupWriteMapped(const GasAbsLookup& abs_lookup,
+                           const String& filename,
+                           const Verbosity& verbosity) {
+  abs_lookup.WriteMapped(filename, verbosity);
+}
+
+/** One tile of abs_lookupCalc
+ *
+ * A tile is all frequencies and pressures of one species, one H2O VMR
+ * perturbation and one temperature perturbation
+ */
+struct LookupTile {
+  //! Index of the species in abs_species
+  Index species;
+  //! Index in the species dimension of the table
+  Index spec;
+  //! Index in the temperature perturbation dimension of the table
+  Index t_pert_index;
+  //! The H2O VMR scaling
+  Numeric nls_pert;
+  //! The temperature perturbation
+  Numeric t_pert;
+};
+
+/** Name of a tile, used to verify checkpoint files
+ *
+ * @param[in] abs_species As WSV
+ * @param[in] tile The tile
+ * @return The name of the tile
+ */
+String lookup_tile_name(const ArrayOfArrayOfSpeciesTag& abs_species,
+                        const LookupTile& tile) {
+  ostringstream os;
+  os << std::setprecision(17) << get_tag_group_name(abs_species[tile.species])
+     << ", nls_pert " << tile.nls_pert << ", t_pert " << tile.t_pert;
+  return os.str();
+}
+
+/** Fingerprint of the input that all tiles share, used to verify checkpoint files
+ *
+ * A checkpoint can only be reused with the same reference profiles, species
+ * and line catalog.  These are written out in full precision and hashed
+ * with 64-bit FNV-1a, which gives the same fingerprint in every run and
+ * build
+ *
+ * @param[in] abs_species As WSV
+ * @param[in] abs_nls As WSV
+ * @param[in] abs_lines_per_species As WSV
+ * @param[in] abs_t As WSV, the reference temperatures
+ * @param[in] abs_vmrs As WSV, the reference VMRs
+ * @return The fingerprint as a hexadecimal number
+ */
+String lookup_tiles_fingerprint(
+    const ArrayOfArrayOfSpeciesTag& abs_species,
+    const ArrayOfArrayOfSpeciesTag& abs_nls,
+    const ArrayOfArrayOfAbsorptionLines& abs_lines_per_species,
+    const Vector& abs_t,
+    const Matrix& abs_vmrs) {
+  ostringstream os;
+  os << std::setprecision(17);
+  for (auto& species : abs_species) os << get_tag_group_name(species) << '\n';
+  for (auto& species : abs_nls) os << get_tag_group_name(species) << '\n';
+  os << abs_t << '\n' << abs_vmrs << '\n';
+  for (auto& lines : abs_lines_per_species) {
+    for (auto& band : lines) os << band.MetaData() << band;
+    os << '\n';
+  }
+
+  std::uint64_t hash = 14695981039346656037ull;
+  for (unsigned char c : os.str()) {
+    hash ^= c;
+    hash *= 1099511628211ull;
+  }
+
+  ostringstream fingerprint;
+  fingerprint << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return fingerprint.str();
+}
+
+/** Checkpoint file of a tile
+ *
+ * The name is resolved against the output directory and made absolute
+ * once, so that writing, renaming and reading all use the same file and
+ * reading does not search the include path
+ *
+ * @param[in] basename The basename of all checkpoint files
+ * @param[in] tile The tile
+ * @return The absolute file name
+ */
+String lookup_tile_filename(const String& basename, const LookupTile& tile) {
+  ostringstream os;
+  os << basename << ".tile." << tile.spec << "." << tile.t_pert_index
+     << ".xml";
+
+  String filename = add_basedir(os.str());
+  if (filename.nelem() and filename[0] != '/') {
+    char* buf = getcwd(nullptr, 0);
+    filename = String(buf) + "/" + filename;
+    free(buf);
+  }
+  return filename;
+}
+
+/** Restores a tile from its checkpoint file
+ *
+ * Values are taken from the file for every frequency and pressure that is
+ * found exactly in its grids.  Everything that is missing is listed so
+ * that only that has to be computed: all pressures of f_missing, and the
+ * p_missing pressures of f_present.  Without a usable file, all
+ * frequencies are missing
+ *
+ * @param[out] xsec The tile, restored values set and all others untouched
+ * @param[out] f_missing Indices of frequencies that are not in the file
+ * @param[out] f_present Indices of frequencies that are in the file
+ * @param[out] p_missing Indices of pressures that are not in the file
+ * @param[in] filename The checkpoint file, empty for none
+ * @param[in] name The name of the tile and the fingerprint of its input
+ * @param[in] f_grid As WSV
+ * @param[in] abs_p As WSV
+ * @param[in] verbosity As WSV
+ */
+void lookup_tile_restore(Matrix& xsec,
+                         ArrayOfIndex& f_missing,
+                         ArrayOfIndex& f_present,
+                         ArrayOfIndex& p_missing,
+                         const String& filename,
+                         const String& name,
+                         const Vector& f_grid,
+                         const Vector& abs_p,
+                         const Verbosity& verbosity) {
+  CREATE_OUT3;
+
+  GriddedField2 stored;
+  if (filename.length() and file_exists(filename)) {
+    try {
+      xml_read_from_file(filename, stored, verbosity);
+    } catch (const std::runtime_error& e) {
+      ostringstream os;
+      os << "  Ignoring unreadable checkpoint " << filename << ":\n"
+         << e.what() << "\n";
+      out3 << os.str();
+      stored = GriddedField2();
+    }
+    if (stored.get_name() not_eq name or not stored.checksize()) {
+      ostringstream os;
+      os << "  Ignoring checkpoint " << filename
+         << " of another tile or other input.\n";
+      out3 << os.str();
+      stored = GriddedField2();
+    }
+  }
+
+  // Positions of the grid points in the stored grids
+  auto positions = [](const Vector& grid, const Vector& old_grid) {
+    std::map<Numeric, Index> old_pos;
+    for (Index i = 0; i < old_grid.nelem(); i++) old_pos[old_grid[i]] = i;
+    ArrayOfIndex pos(grid.nelem(), -1);
+    for (Index i = 0; i < grid.nelem(); i++) {
+      auto x = old_pos.find(grid[i]);
+      if (x not_eq old_pos.end()) pos[i] = x->second;
+    }
+    return pos;
+  };
+
+  const bool has_stored = stored.get_grid_size(0) and stored.get_grid_size(1);
+  const ArrayOfIndex f_pos =
+      has_stored ? positions(f_grid, stored.get_numeric_grid(0))
+                 : ArrayOfIndex(f_grid.nelem(), -1);
+  const ArrayOfIndex p_pos =
+      has_stored ? positions(abs_p, stored.get_numeric_grid(1))
+                 : ArrayOfIndex(abs_p.nelem(), -1);
+
+  f_missing.resize(0);
+  f_present.resize(0);
+  p_missing.resize(0);
+  for (Index i = 0; i < f_grid.nelem(); i++)
+    (f_pos[i] < 0 ? f_missing : f_present).push_back(i);
+  for (Index i = 0; i < abs_p.nelem(); i++)
+    if (p_pos[i] < 0) p_missing.push_back(i);
+
+  for (auto i : f_present)
+    for (Index j = 0; j < abs_p.nelem(); j++)
+      if (p_pos[j] >= 0) xsec(i, j) = stored.data(f_pos[i], p_pos[j]);
+}
+
+/** Writes a finished tile to its checkpoint file
+ *
+ * The XML header and its binary data file are first written under a
+ * temporary name.  The old header is then removed before the data file
+ * and the header are renamed, so that a killed job never leaves a header
+ * that points to data of another write behind.  A header without data
+ * is rejected when the tile is restored
+ *
+ * @param[in] filename The absolute checkpoint file, see lookup_tile_filename
+ * @param[in] name The name of the tile and the fingerprint of its input
+ * @param[in] xsec The tile
+ * @param[in] f_grid As WSV
+ * @param[in] abs_p As WSV
+ * @param[in] verbosity As WSV
+ */
+void lookup_tile_store(const String& filename,
+                       const String& name,
+                       const Matrix& xsec,
+                       const Vector& f_grid,
+                       const Vector& abs_p,
+                       const Verbosity& verbosity) {
+  GriddedField2 stored(name);
+  stored.set_grid_name(0, "Frequency");
+  stored.set_grid(0, f_grid);
+  stored.set_grid_name(1, "Pressure");
+  stored.set_grid(1, abs_p);
+  stored.data = xsec;
+
+  const String tmpfile = filename + ".tmp";
+  xml_write_to_file(tmpfile, stored, FILE_TYPE_BINARY, 0, verbosity);
+
+  auto move = [](const String& from, const String& to) {
+    if (std::rename(from.c_str(), to.c_str())) {
+      ostringstream os;
+      os << "Cannot move checkpoint " << from << " to " << to;
+      throw runtime_error(os.str());
+    }
+  };
+  std::remove(filename.c_str());
+  move(tmpfile + ".bin", filename + ".bin");
+  move(tmpfile, filename);
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void abs_lookupCalc(  // Workspace reference:
     Workspace& ws,
@@ -71,30 +320,21 @@ void abs_lookupCalc(  // Workspace reference:
     const Vector& abs_t,
     const Vector& abs_t_pert,
     const Vector& abs_nls_pert,
+    const ArrayOfArrayOfAbsorptionLines& abs_lines_per_species,
     const Agenda& abs_xsec_agenda,
+    // WS Generic Input:
+    const String& checkpoint_basename,
     // Verbosity object:
     const Verbosity& verbosity) {
   CREATE_OUT2;
   CREATE_OUT3;
 
-  // We need this temporary variable to make a local copy of all VMRs,
-  // where we then perturb the H2O profile as needed
-  Matrix these_all_vmrs = abs_vmrs;
-
   // We will be calling an absorption agenda one species at a
   // time. This is better than doing all simultaneously, because is
   // saves memory and allows for consistent treatment of nonlinear
-  // species. But it means we need local copies of species, line list,
-  // and line shapes for agenda communication.
-
-  // 1. Output of absorption calculations:
-
-  // Absorption coefficients:
-  Matrix these_abs_coef;
+  // species.
 
-  // Absorption cross sections per tag group.
-  ArrayOfMatrix abs_xsec_per_species, src_xsec_per_species;
-  ArrayOfArrayOfMatrix dabs_xsec_per_species_dx, dsrc_xsec_per_species_dx;
+  // 1. Output of absorption calculations is local to each tile, see 7.
 
   // 2. Determine various important sizes:
   const Index n_species = abs_species.nelem();  // Number of abs species
@@ -106,23 +346,13 @@ void abs_lookupCalc(  // Workspace reference:
 
   // 3. Input to absorption calculations:
 
-  // Absorption vmrs and temperature:
-  Matrix this_vmr(1, n_p_grid);
-  Vector abs_h2o(n_p_grid);
+  // Absorption temperature:
   Vector this_t;  // Has same dimension, but is
                   // initialized by assignment later.
   const EnergyLevelMap this_nlte_dummy;
 
-  // Species list, lines, and line shapes, all with only 1 element:
-  ArrayOfArrayOfSpeciesTag this_species(1);
-
-  // List of active species for agenda call. Will always be filled with only
-  // one species.
-  ArrayOfIndex abs_species_active(1);
-
-  // Local copy of nls_pert and t_pert:
-  Vector these_nls_pert;  // Is resized every time when used
-  Vector these_t_pert;    // Is resized later on
+  // Local copy of t_pert:
+  Vector these_t_pert;  // Is resized later on
 
   // 4. Checks of input parameter correctness:
 
@@ -234,6 +464,7 @@ void abs_lookupCalc(  // Workspace reference:
 
     abs_lookup.xsec.resize(a, b, c, d);
     abs_lookup.xsec = NAN;
+    abs_lookup.XsecStoreReset();
   }
 
   // 6.a. Set up these_t_pert. This is done so that we can use the
@@ -253,18 +484,12 @@ void abs_lookupCalc(  // Workspace reference:
 
   // 7. Now we have to fill abs_lookup.xsec with the right values!
 
-  String fail_msg;
-  bool failed = false;
-
-  // We have to make a local copy of the Workspace and the agenda because
-  // only non-reference types can be declared firstprivate in OpenMP
-  Workspace l_ws(ws);
-  Agenda l_abs_xsec_agenda(abs_xsec_agenda);
-
-  // Loop species:
+  // The table is computed in tiles.  Each tile is one species, one H2O VMR
+  // variant and one temperature variant over all frequencies and pressures.
+  // Skipping Zeeman, free_electrons, and particle species.
+  // (Mixed tag groups between those and other species are not allowed.)
+  std::vector<LookupTile> tiles;
   for (Index i = 0, spec = 0; i < n_species; ++i) {
-    // Skipping Zeeman and free_electrons species.
-    // (Mixed tag groups between those and other species are not allowed.)
     if (is_zeeman(abs_species[i]) ||
         abs_species[i][0].Type() == SpeciesTag::TYPE_FREE_ELECTRONS ||
         abs_species[i][0].Type() == SpeciesTag::TYPE_PARTICLES) {
@@ -272,174 +497,145 @@ void abs_lookupCalc(  // Workspace reference:
       continue;
     }
 
-    // spec is the index for the second dimension of abs_lookup.xsec.
-
-    // Prepare absorption agenda input for this species:
-    out2 << "  Doing species " << i + 1 << " of " << n_species << ": "
-         << abs_species[i] << ".\n";
+    const Index n_s = non_linear[i] ? n_nls_pert : 1;
+    for (Index s = 0; s < n_s; ++s, ++spec)
+      for (Index j = 0; j < these_t_pert_nelem; ++j)
+        tiles.push_back({i,
+                         spec,
+                         j,
+                         non_linear[i] ? abs_nls_pert[s] : 1,
+                         these_t_pert[j]});
+  }
+  const Index n_tiles = Index(tiles.size());
 
-    // Set active species:
-    abs_species_active[0] = i;
+  // Checkpoints of other input are not reused
+  const String inputs =
+      checkpoint_basename.length()
+          ? lookup_tiles_fingerprint(
+                abs_species, abs_nls, abs_lines_per_species, abs_t, abs_vmrs)
+          : "";
 
-    // Get a dummy list of tag groups with only the current element:
-    this_species[0].resize(abs_species[i].nelem());
-    this_species[0] = abs_species[i];
+  String fail_msg;
+  bool failed = false;
 
-    // Set up these_nls_pert. This is done so that we can use the
-    // same loop over the perturbations, independent of
-    // whether we have nonlinear species or not.
-    if (non_linear[i]) {
-      out2 << "  This is a species with H2O VMR perturbations.\n";
-      these_nls_pert.resize(n_nls_pert);
-      these_nls_pert = abs_nls_pert;
-    } else {
-      these_nls_pert.resize(1);
-      these_nls_pert = 1;
-    }
+  // We have to make a local copy of the Workspace and the agenda because
+  // only non-reference types can be declared firstprivate in OpenMP
+  Workspace l_ws(ws);
+  Agenda l_abs_xsec_agenda(abs_xsec_agenda);
 
-    // Loop these_nls_pert:
-    for (Index s = 0; s < these_nls_pert.nelem(); ++s, ++spec) {
-      // Remember, spec is the index for the second dimension of
-      // abs_lookup.xsec
+#pragma omp parallel for schedule(dynamic) if (                \
+    !arts_omp_in_parallel() &&                                 \
+    n_tiles >= arts_omp_get_max_threads()) private(this_t)     \
+    firstprivate(l_ws, l_abs_xsec_agenda)
+  for (Index it = 0; it < n_tiles; ++it) {
+    // Skip remaining iterations if an error occurred
+    if (failed) continue;
 
-      if (non_linear[i]) {
-        out2 << "  Doing H2O VMR variant " << s + 1 << " of " << n_nls_pert
-             << ": " << abs_nls_pert[s] << ".\n";
+    // The try block here is necessary to correctly handle
+    // exceptions inside the parallel region.
+    try {
+      const LookupTile& tile = tiles[it];
+      const String tile_name = lookup_tile_name(abs_species, tile);
+      const String tile_id = tile_name + ", inputs " + inputs;
+      const String tile_file =
+          checkpoint_basename.length()
+              ? lookup_tile_filename(checkpoint_basename, tile)
+              : "";
+
+      // We first prepare the output in a string here, so that we can
+      // write it to out3 with a single operation. This avoids messy
+      // output from multiple threads.
+      {
+        ostringstream os;
+        os << "  Doing tile " << it + 1 << " of " << n_tiles << ": "
+           << tile_name << ".\n";
+        out3 << os.str();
       }
 
       // Make a local copy of the VMRs, and manipulate the H2O VMR within it.
-      // Note: We do not need a runtime error check that h2o_index is ok here,
-      // because earlier on we throw an error if there is no H2O species although we
-      // need it. So, if h2o_indes is -1, we here simply assume that there
-      // should not be a perturbation
-      if (h2o_index >= 0) {
-        these_all_vmrs(h2o_index, joker) = abs_vmrs(h2o_index, joker);
-        these_all_vmrs(h2o_index, joker) *=
-            these_nls_pert[s];  // Add perturbation
-      }
-
-      // VMR for this species (still needed by interfact to continua):
-      // FIXME: This variable may go away eventually, when the continuum
-      // part no longer needs it.
-      this_vmr(0, joker) = these_all_vmrs(i, joker);
-
-      // For abs_h2o, we can always add the perturbations (it will
-      // not make a difference if the species itself is also H2O).
-      // Attention, we need to treat here also the case that there
-      // is no H2O species. We will then set abs_h2o to
-      // -1. Absorption routines that do not really need abs_h2o
-      // will still run.
-      //
-      // FIXME: abs_h2o is currently still needed by the continuum part.
-      // Should go away eventually.
-      if (h2o_index == -1) {
-        // The case without H2O species.
-        abs_h2o.resize(1);
-        abs_h2o = -1;
-      } else {
-        // The normal case.
-        abs_h2o = these_all_vmrs(h2o_index, joker);
-      }
-
-      // Loop temperature perturbations
-      // ------------------------------
-
-      // We use a parallel for loop for this.
-
-      // There is something strange here: abs_lookup seems to be
-      // "shared" by default, although I have set default(none). I
-      // suspect that the reason for this behavior is that
-      // abs_lookup is a return by reference parameter of this
-      // function. Anyway, shared is the correct setting for
-      // abs_lookup, so there is no problem.
-
-#pragma omp parallel for if (                                         \
-    !arts_omp_in_parallel() &&                                        \
-    these_t_pert_nelem >=                                             \
-        arts_omp_get_max_threads()) private(this_t,                   \
-                                            abs_xsec_per_species,     \
-                                            src_xsec_per_species,     \
-                                            dabs_xsec_per_species_dx, \
-                                            dsrc_xsec_per_species_dx) \
-    firstprivate(l_ws, l_abs_xsec_agenda)
-      for (Index j = 0; j < these_t_pert_nelem; ++j) {
-        // Skip remaining iterations if an error occurred
-        if (failed) continue;
-
-        // The try block here is necessary to correctly handle
-        // exceptions inside the parallel region.
-        try {
-          if (0 != n_t_pert) {
-            // We first prepare the output in a string here,
-            // so that we can write it to out3 with a single
-            // operation. This avoids messy output from
-            // multiple threads.
-            ostringstream os;
-
-            os << "  Doing temperature variant " << j + 1 << " of " << n_t_pert
-               << ": " << these_t_pert[j] << ".\n";
-
-            out3 << os.str();
-          }
+      // If h2o_index is -1, there should not be a perturbation
+      Matrix these_all_vmrs = abs_vmrs;
+      if (h2o_index >= 0) these_all_vmrs(h2o_index, joker) *= tile.nls_pert;
+
+      // Create perturbed temperature profile:
+      this_t = abs_lookup.t_ref;
+      this_t += tile.t_pert;
+
+      // Values of this tile that are already known
+      Matrix tile_xsec(n_f_grid, n_p_grid, NAN);
+      ArrayOfIndex f_missing, f_present, p_missing;
+      lookup_tile_restore(tile_xsec,
+                          f_missing,
+                          f_present,
+                          p_missing,
+                          tile_file,
+                          tile_id,
+                          f_grid,
+                          abs_p,
+                          verbosity);
 
-          // Create perturbed temperature profile:
-          this_t = abs_lookup.t_ref;
-          this_t += these_t_pert[j];
-
-          // Call agenda to calculate absorption:
-          abs_xsec_agendaExecute(l_ws,
-                                 abs_xsec_per_species,
-                                 src_xsec_per_species,
-                                 dabs_xsec_per_species_dx,
-                                 dsrc_xsec_per_species_dx,
-                                 abs_species,
-                                 ArrayOfRetrievalQuantity(0),
-                                 abs_species_active,
-                                 f_grid,
-                                 abs_p,
-                                 this_t,
-                                 this_nlte_dummy,
-                                 these_all_vmrs,
-                                 l_abs_xsec_agenda);
-
-          // Store in the right place:
-          // Loop through all altitudes
-          for (Index p = 0; p < n_p_grid; ++p) {
-            abs_lookup.xsec(j, spec, Range(joker), p) =
-                abs_xsec_per_species[i](Range(joker), p);
-
-            // There used to be a division by the number density
-            // n here. This is no longer necessary, since
-            // abs_xsec_per_species now contains true absorption
-            // cross sections.
-
-            // IMPORTANT: There was a bug in my old Matlab
-            // function "create_lookup.m" to generate the lookup
-            // table. (The number density was always the
-            // reference one, and did not change for different
-            // temperatures.) Patricks Atmlab function
-            // "arts_abstable_from_arts1.m" did *not* have this bug.
-
-            // Calculate the number density for the given pressure and
-            // temperature:
-            // n = n0*T0/p0 * p/T or n = p/kB/t, ideal gas law
-            //                  const Numeric n = number_density( abs_lookup.p_grid[p],
-            //                                                    this_t[p]   );
-            //                  abs_lookup.xsec( j, spec, Range(joker), p ) /= n;
-          }
-        }  // end of try block
-        catch (const std::runtime_error& e) {
-#pragma omp critical(abs_lookupCalc_fail)
-          {
-            fail_msg = e.what();
-            failed = true;
-          }
+      // Compute the cross-sections of the given frequencies and pressures
+      auto compute = [&](const ArrayOfIndex& fi, const ArrayOfIndex& pi) {
+        Vector sub_f(fi.nelem()), sub_p(pi.nelem()), sub_t(pi.nelem());
+        Matrix sub_vmrs(n_species, pi.nelem());
+        for (Index k = 0; k < fi.nelem(); k++) sub_f[k] = f_grid[fi[k]];
+        for (Index k = 0; k < pi.nelem(); k++) {
+          sub_p[k] = abs_p[pi[k]];
+          sub_t[k] = this_t[pi[k]];
+          sub_vmrs(joker, k) = these_all_vmrs(joker, pi[k]);
         }
-      }  // end of parallel for loop
 
-      if (failed) throw runtime_error(fail_msg);
+        ArrayOfMatrix abs_xsec_per_species, src_xsec_per_species;
+        ArrayOfArrayOfMatrix dabs_xsec_per_species_dx,
+            dsrc_xsec_per_species_dx;
+        abs_xsec_agendaExecute(l_ws,
+                               abs_xsec_per_species,
+                               src_xsec_per_species,
+                               dabs_xsec_per_species_dx,
+                               dsrc_xsec_per_species_dx,
+                               abs_species,
+                               ArrayOfRetrievalQuantity(0),
+                               ArrayOfIndex(1, tile.species),
+                               sub_f,
+                               sub_p,
+                               sub_t,
+                               this_nlte_dummy,
+                               sub_vmrs,
+                               l_abs_xsec_agenda);
+
+        // abs_xsec_per_species holds true absorption cross sections, so
+        // there is no division by the number density
+        for (Index k = 0; k < fi.nelem(); k++)
+          for (Index l = 0; l < pi.nelem(); l++)
+            tile_xsec(fi[k], pi[l]) =
+                abs_xsec_per_species[tile.species](k, l);
+      };
+
+      ArrayOfIndex p_all(n_p_grid);
+      for (Index p = 0; p < n_p_grid; p++) p_all[p] = p;
+
+      if (f_missing.nelem()) compute(f_missing, p_all);
+      if (p_missing.nelem() and f_present.nelem())
+        compute(f_present, p_missing);
+
+      // Store in the right place:
+      abs_lookup.xsec(tile.t_pert_index, tile.spec, joker, joker) = tile_xsec;
+
+      // Checkpoint the finished tile
+      if (tile_file.length() and (f_missing.nelem() or p_missing.nelem()))
+        lookup_tile_store(
+            tile_file, tile_id, tile_xsec, f_grid, abs_p, verbosity);
+    }  // end of try block
+    catch (const std::runtime_error& e) {
+#pragma omp critical(abs_lookupCalc_fail)
+      {
+        fail_msg = e.what();
+        failed = true;
+      }
     }
-  }
+  }  // end of parallel for loop
+
+  if (failed) throw runtime_error(fail_msg);
 
   // 6. Initialize fgp_default.
   abs_lookup.fgp_default.resize(f_grid.nelem());
@@ -2013,8 +2209,9 @@ void abs_lookupAdapt(GasAbsLookup& abs_lookup,
                      Index& abs_lookup_is_adapted,
                      const ArrayOfArrayOfSpeciesTag& abs_species,
                      const Vector& f_grid,
+                     const Index& view,
                      const Verbosity& verbosity) {
-  abs_lookup.Adapt(abs_species, f_grid, verbosity);
+  abs_lookup.Adapt(abs_species, f_grid, view, verbosity);
   abs_lookup_is_adapted = 1;
 }
 
@@ -2038,7 +2235,8 @@ void propmat_clearskyAddFromLookup(
   CREATE_OUT3;
 
   // Variables needed by abs_lookup.Extract:
-  Matrix abs_scalar_gas, dabs_scalar_gas_df, dabs_scalar_gas_dt;
+  Matrix dabs_scalar_gas_df;
+  Tensor3 abs_scalar_gas_batch;
 
   // Check if the table has been adapted:
   if (1 != abs_lookup_is_adapted)
@@ -2066,17 +2264,32 @@ void propmat_clearskyAddFromLookup(
   
   // The function we are going to call here is one of the few helper
   // functions that adjust the size of their output argument
-  // automatically.
-  abs_lookup.Extract(abs_scalar_gas,
-                     abs_p_interp_order,
-                     abs_t_interp_order,
-                     abs_nls_interp_order,
-                     abs_f_interp_order,
-                     a_pressure,
-                     a_temperature,
-                     a_vmr_list,
-                     f_grid,
-                     extpolfac);
+  // automatically. The unperturbed atmosphere and the temperature
+  // perturbation are extracted as one batch, so that they share the
+  // checks and the frequency interpolation weights.
+  const Index n_batch = do_temp_jac ? 2 : 1;
+  const Vector batch_p(n_batch, a_pressure);
+  Vector batch_t(n_batch, a_temperature);
+  if (do_temp_jac) batch_t[1] += dt;
+  Matrix batch_vmrs(a_vmr_list.nelem(), n_batch);
+  for (Index i = 0; i < n_batch; i++) batch_vmrs(joker, i) = a_vmr_list;
+
+  abs_lookup.ExtractBatch(abs_scalar_gas_batch,
+                          abs_p_interp_order,
+                          abs_t_interp_order,
+                          abs_nls_interp_order,
+                          abs_f_interp_order,
+                          batch_p,
+                          batch_t,
+                          batch_vmrs,
+                          f_grid,
+                          extpolfac);
+  const ConstMatrixView abs_scalar_gas = abs_scalar_gas_batch(0, joker, joker);
+
+  // Only used if do_temp_jac:
+  const ConstMatrixView dabs_scalar_gas_dt =
+      abs_scalar_gas_batch(n_batch - 1, joker, joker);
+
   if (do_freq_jac) {
     Vector dfreq = f_grid;
     dfreq += df;
@@ -2091,19 +2304,6 @@ void propmat_clearskyAddFromLookup(
                        dfreq,
                        extpolfac);
   }
-  if (do_temp_jac) {
-    const Numeric dtemp = a_temperature + dt;
-    abs_lookup.Extract(dabs_scalar_gas_dt,
-                       abs_p_interp_order,
-                       abs_t_interp_order,
-                       abs_nls_interp_order,
-                       abs_f_interp_order,
-                       a_pressure,
-                       dtemp,
-                       a_vmr_list,
-                       f_grid,
-                       extpolfac);
-  }
 
   // Now add to the right place in the absorption matrix.
 
@@ -2853,12 +3053,68 @@ void abs_lookupTestAccuracy(  // Workspace reference:
         }
       }
 
+  // Check the storage error. At the grid points of the table there is
+  // no interpolation, so with Float or Quantized storage this is the
+  // error of the stored cross sections.
+
+  // To store the storage error, which we define as the maximum of
+  // the absolute value of the relative difference between LBL and
+  // lookup table, in percent.
+  Numeric err_storage = 0;
+
+  if (al.Storage() != LookupStorage::Double) {
+#pragma omp parallel for if (!arts_omp_in_parallel())
+    for (Index pi = 0; pi < n_p; ++pi)
+      for (Index ti = 0; ti < al.t_pert.nelem(); ++ti)
+        for (Index ni = 0; ni < al.nls_pert.nelem(); ++ni) {
+          // Find local conditions:
+
+          // Pressure:
+          Numeric local_p = al.p_grid[pi];
+
+          // Temperature:
+          Numeric local_t = al.t_ref[pi] + al.t_pert[ti];
+
+          // VMRs:
+          Vector local_vmrs = al.vmrs_ref(joker, pi);
+
+          // Multiply with perturbation.
+          local_vmrs[h2o_index] *= al.nls_pert[ni];
+
+          Numeric max_abs_rel_diff =
+              calc_lookup_error(ws,
+                                // Parameters for lookup table:
+                                al,
+                                abs_p_interp_order,
+                                abs_t_interp_order,
+                                abs_nls_interp_order,
+                                true,  // ignore errors
+                                // Parameters for LBL:
+                                abs_xsec_agenda,
+                                // Parameters for both:
+                                local_p,
+                                local_t,
+                                local_vmrs,
+                                verbosity);
+
+          //Critical directive here is necessary, because all threads
+          //access the same variable.
+#pragma omp critical(abs_lookupTestAccuracy_storage)
+          {
+            if (max_abs_rel_diff > err_storage) err_storage = max_abs_rel_diff;
+          }
+        }
+  }
+
   out2 << "  Max. of absolute value of relative error in percent:\n"
        << "  Note: Unless you have constant reference profiles, the\n"
        << "  pressure interpolation error will have other errors mixed in.\n"
        << "  Temperature interpolation: " << err_t << "%\n"
        << "  H2O (NLS) interpolation:   " << err_nls << "%\n"
        << "  Pressure interpolation:    " << err_p << "%\n"
+       << "  Storage:                   " << err_storage << "% ("
+       << lookupstorage2string(al.Storage()) << ", bound "
+       << 100 * al.StorageErrorBound() << "%)\n"
        << "  Total error:               " << err_tot << "%\n";
 
   // Check pressure interpolation
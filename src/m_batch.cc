@@ -37,11 +37,13 @@
   ===========================================================================*/
 
 #include <cmath>
+#include <vector>
 using namespace std;
 
 #include "arts.h"
 #include "arts_omp.h"
 #include "auto_md.h"
+#include "disort.h"
 #include "math_funcs.h"
 #include "physics_funcs.h"
 #include "rte.h"
@@ -689,6 +691,10 @@ void DOBatchCalc(Workspace& ws,
   Workspace l_ws(ws);
   Agenda l_dobatch_calc_agenda(dobatch_calc_agenda);
 
+  // The DISORT calls of the cases on each thread share a phase cache, so
+  // that the phase functions of the same scattering data are derived once
+  std::vector<DisortPhaseCache> phase_caches(arts_omp_get_max_threads());
+
   // Go through the batch:
 
   if (ybatch_n)
@@ -717,6 +723,8 @@ void DOBatchCalc(Workspace& ws,
         Tensor4 irradiance_field;
         Tensor5 spectral_irradiance_field;
 
+        DisortPhaseCacheScope phase_cache_scope(
+            phase_caches[arts_omp_get_thread_num()]);
         dobatch_calc_agendaExecute(l_ws,
                                    cloudbox_field,
                                    radiance_field,
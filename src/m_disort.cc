@@ -76,6 +76,7 @@ void DisortCalc(Workspace& ws,
                 const String& pfct_method,
                 const Index& Npfct,
                 const Index& cdisort_quiet,
+                const Index& f_chunk_size,
                 const Verbosity& verbosity) {
   // Don't do anything if there's no cloudbox defined.
   if (!cloudbox_on) {
@@ -103,6 +104,9 @@ void DisortCalc(Workspace& ws,
   init_ifield(
       cloudbox_field, f_grid, cloudbox_limits, za_grid.nelem(), stokes_dim);
 
+  // Our own phase cache, unless a batch shares one
+  DisortPhaseCache phase_cache;
+
   Vector albedo(f_grid.nelem(), 0.);
   Numeric btemp;
 
@@ -127,6 +131,8 @@ void DisortCalc(Workspace& ws,
               nstreams,
               Npfct,
               cdisort_quiet,
+              f_chunk_size,
+              DisortPhaseCacheScope::Current(phase_cache),
               verbosity);
 }
 
@@ -158,6 +164,7 @@ void DisortCalcWithARTSSurface(
     const String& pfct_method,
     const Index& Npfct,
     const Index& cdisort_quiet,
+    const Index& f_chunk_size,
     const Verbosity& verbosity) {
   if (!cloudbox_on) {
     CREATE_OUT0;
@@ -188,6 +195,9 @@ void DisortCalcWithARTSSurface(
   init_ifield(
       cloudbox_field, f_grid, cloudbox_limits, za_grid.nelem(), stokes_dim);
 
+  // Our own phase cache, unless a batch shares one
+  DisortPhaseCache phase_cache;
+
   Vector albedo(f_grid.nelem(), 0.);
   Numeric btemp;
 
@@ -224,6 +234,8 @@ void DisortCalcWithARTSSurface(
               nstreams,
               Npfct,
               cdisort_quiet,
+              f_chunk_size,
+              DisortPhaseCacheScope::Current(phase_cache),
               verbosity);
 }
 
@@ -246,6 +258,7 @@ void DisortCalcClearsky(Workspace& ws,
                         const Vector& surface_scalar_reflectivity,
                         const Index& nstreams,
                         const Index& cdisort_quiet,
+                        const Index& f_chunk_size,
                         const Verbosity& verbosity) {
   if (atmosphere_dim != 1)
     throw runtime_error(
@@ -307,5 +320,6 @@ void DisortCalcClearsky(Workspace& ws,
              "median",
              181,
              cdisort_quiet,
+             f_chunk_size,
              verbosity);
 }
@@ -60,6 +60,7 @@
 #include "xml_io.h"
 
 extern const Numeric PI;
+extern const Numeric DEG2RAD;
 extern const Numeric RAD2DEG;
 
 /*===========================================================================
@@ -503,6 +504,8 @@ void cloudbox_field_monoIterate(Workspace& ws,
                                 const Agenda& doit_rte_agenda,
                                 const Agenda& doit_conv_test_agenda,
                                 const Index& accelerated,
+                                const String& acceleration_method,
+                                const Index& acceleration_memory,
                                 const Verbosity& verbosity)
 
 {
@@ -513,6 +516,17 @@ void cloudbox_field_monoIterate(Workspace& ws,
   chk_not_empty("doit_rte_agenda", doit_rte_agenda);
   chk_not_empty("doit_conv_test_agenda", doit_conv_test_agenda);
 
+  const bool anderson = acceleration_method == "Anderson";
+  if (!anderson && acceleration_method != "NG") {
+    ostringstream os;
+    os << "Unknown *acceleration_method*: \"" << acceleration_method
+       << "\".\nValid choices are \"NG\" and \"Anderson\".";
+    throw runtime_error(os.str());
+  }
+  if (anderson && accelerated > 0 && acceleration_memory < 1)
+    throw runtime_error(
+        "*acceleration_memory* must be at least 1 for Anderson acceleration.");
+
   for (Index v = 0; v < cloudbox_field_mono.nvitrines(); v++)
     for (Index s = 0; s < cloudbox_field_mono.nshelves(); s++)
       for (Index b = 0; b < cloudbox_field_mono.nbooks(); b++)
@@ -547,9 +561,11 @@ void cloudbox_field_monoIterate(Workspace& ws,
   doit_iteration_counter_local = 0;
   // Array to save the last iteration steps
   ArrayOfTensor6 acceleration_input;
-  if (accelerated) {
+  if (accelerated && !anderson) {
     acceleration_input.resize(4);
   }
+  // History of Anderson acceleration
+  ArrayOfVector anderson_x, anderson_g;
   while (doit_conv_flag_local == 0) {
     // 1. Copy cloudbox_field to cloudbox_field_old.
     cloudbox_field_mono_old_local = cloudbox_field_mono;
@@ -575,7 +591,15 @@ void cloudbox_field_monoIterate(Workspace& ws,
                                  doit_conv_test_agenda);
 
     // Convergence Acceleration, if wished.
-    if (accelerated > 0 && doit_conv_flag_local == 0) {
+    if (accelerated > 0 && doit_conv_flag_local == 0 && anderson) {
+      cloudbox_field_andersonAcceleration(cloudbox_field_mono,
+                                          anderson_x,
+                                          anderson_g,
+                                          cloudbox_field_mono_old_local,
+                                          accelerated,
+                                          acceleration_memory,
+                                          verbosity);
+    } else if (accelerated > 0 && doit_conv_flag_local == 0) {
       acceleration_input[(doit_iteration_counter_local - 1) % 4] =
           cloudbox_field_mono;
       // NG - Acceleration
@@ -585,6 +609,9 @@ void cloudbox_field_monoIterate(Workspace& ws,
       }
     }
   }  //end of while loop, convergence is reached.
+
+  out2 << "  DOIT converged after " << doit_iteration_counter_local
+       << " iterations.\n";
 }
 
 /* Workspace method: Doxygen documentation will be auto-generated */
@@ -2208,53 +2235,60 @@ void doit_scat_fieldCalc(Workspace& ws,
   out2 << "  Calculate the scattered field\n";
 
   if (atmosphere_dim == 1) {
-    // Get pha_mat at the grid positions
-    // Since atmosphere_dim = 1, there is no loop over lat and lon grids
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
-      //There is only loop over zenith angle grid ; no azimuth angle grid.
-      for (Index za_index_local = 0; za_index_local < Nza; za_index_local++) {
-        // Calculate the phase matrix of individual scattering elements
-        out3 << "Multiplication of phase matrix with incoming"
-             << " intensities \n";
+    // pha_mat_doit holds the bulk phase matrices of the frequency and does
+    // not change between iterations. The quadrature weights of the angular
+    // integration are therefore folded into the incoming field, so that
+    // the scattering integral becomes one contraction over all incoming
+    // directions and Stokes components per outgoing direction.
+    Matrix ang_weights(Nza, Naa);
+    for (Index za_in = 0; za_in < Nza; za_in++) {
+      const Numeric sin_za = sin(za_grid[za_in] * DEG2RAD);
+      if (Naa == 1) {
+        // Same as AngIntegrate_trapezoid(Vector) / 2 / PI
+        Numeric dza = 0;
+        if (za_in > 0) dza += za_grid[za_in] - za_grid[za_in - 1];
+        if (za_in < Nza - 1) dza += za_grid[za_in + 1] - za_grid[za_in];
+        ang_weights(za_in, 0) = 0.5 * DEG2RAD * dza * sin_za;
+      } else {
+        // Same as AngIntegrate_trapezoid_opti
+        const Numeric wza = (za_in == 0 || za_in == Nza - 1) ? 1 : 2;
+        for (Index aa_in = 0; aa_in < Naa; aa_in++) {
+          const Numeric waa = (aa_in == 0 || aa_in == Naa - 1) ? 1 : 2;
+          ang_weights(za_in, aa_in) = 0.25 * DEG2RAD * DEG2RAD *
+                                      grid_stepsize[0] * grid_stepsize[1] *
+                                      wza * waa * sin_za;
+        }
+      }
+    }
 
-        product_field = 0;
+    const Index Np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
 
-        // za_in and aa_in are for incoming zenith and azimuth
-        //angle direction for which pha_mat is calculated
-        for (Index za_in = 0; za_in < Nza; ++za_in) {
-          for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
-            // Multiplication of phase matrix with incoming
-            // intensity field.
-
-            for (Index i = 0; i < stokes_dim; i++) {
-              for (Index j = 0; j < stokes_dim; j++) {
-                product_field(za_in, aa_in, i) +=
-                    pha_mat_doit(
-                        p_index, za_index_local, 0, za_in, aa_in, i, j) *
-                    cloudbox_field_mono(p_index, 0, 0, za_in, 0, j);
-              }
-            }
+    // Since atmosphere_dim = 1, there is no loop over lat and lon grids
+#pragma omp parallel for if (!arts_omp_in_parallel() && Np > 1)
+    for (Index p_index = 0; p_index < Np; p_index++) {
+      // The incoming field does not depend on the azimuth angle in 1D
+      Tensor3 weighted_field(Nza, Naa, stokes_dim);
+      for (Index za_in = 0; za_in < Nza; za_in++)
+        for (Index aa_in = 0; aa_in < Naa; aa_in++)
+          for (Index j = 0; j < stokes_dim; j++)
+            weighted_field(za_in, aa_in, j) =
+                ang_weights(za_in, aa_in) *
+                cloudbox_field_mono(p_index, 0, 0, za_in, 0, j);
 
-          }  //end aa_in loop
-        }    //end za_in loop
-        //integration of the product of ifield_in and pha
-        //  over zenith angle and azimuth angle grid. It calls
-        if (Naa == 1) {
-          for (Index i = 0; i < stokes_dim; i++) {
-            doit_scat_field(p_index, 0, 0, za_index_local, 0, i) =
-                AngIntegrate_trapezoid(product_field(joker, 0, i), za_grid) /
-                2 / PI;
-          }  //end i loop
-        } else {
-          for (Index i = 0; i < stokes_dim; i++) {
-            doit_scat_field(p_index, 0, 0, za_index_local, 0, i) =
-                AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
-                                            za_grid,
-                                            aa_grid,
-                                            grid_stepsize);
-          }
-        }
+      //There is only loop over zenith angle grid ; no azimuth angle grid.
+      for (Index za_index_local = 0; za_index_local < Nza; za_index_local++) {
+        const ConstTensor4View pha = pha_mat_doit(
+            p_index, za_index_local, 0, joker, Range(0, Naa), joker, joker);
+
+        Vector scat(stokes_dim, 0.);
+        for (Index za_in = 0; za_in < Nza; za_in++)
+          for (Index aa_in = 0; aa_in < Naa; aa_in++)
+            for (Index i = 0; i < stokes_dim; i++)
+              for (Index j = 0; j < stokes_dim; j++)
+                scat[i] += pha(za_in, aa_in, i, j) *
+                           weighted_field(za_in, aa_in, j);
+
+        doit_scat_field(p_index, 0, 0, za_index_local, 0, joker) = scat;
       }  //end za_prop loop
     }    //end p_index loop
   }      //end atmosphere_dim = 1
@@ -2802,6 +2836,7 @@ void DoitCalc(Workspace& ws,
               const Vector& f_grid,
               const Agenda& doit_mono_agenda,
               const Index& doit_is_initialized,
+              const Index& warm_start_chunk,
               const Verbosity& verbosity)
 
 {
@@ -2867,40 +2902,69 @@ void DoitCalc(Workspace& ws,
     String fail_msg;
     bool failed = false;
 
-#pragma omp parallel for if (!arts_omp_in_parallel() && nf > 1) \
+    // Without warm start every frequency forms a chunk of its own
+    const Index chunk = warm_start_chunk > 0 ? warm_start_chunk : 1;
+    const Index nchunks = (nf + chunk - 1) / chunk;
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && nchunks > 1) \
     firstprivate(l_ws, l_doit_mono_agenda)
-    for (Index f_index = 0; f_index < nf; f_index++) {
-      if (failed) {
-        cloudbox_field(f_index, joker, joker, joker, joker, joker, joker) = NAN;
-        continue;
-      }
+    for (Index i_chunk = 0; i_chunk < nchunks; i_chunk++) {
+      const Index f_start = i_chunk * chunk;
+      const Index f_end = min(nf, f_start + chunk);
+
+      // First guess and converged field of the previous frequency
+      Tensor6 prev_first_guess, prev_field;
+
+      for (Index f_index = f_start; f_index < f_end; f_index++) {
+        if (failed) {
+          cloudbox_field(f_index, joker, joker, joker, joker, joker, joker) =
+              NAN;
+          continue;
+        }
+
+        try {
+          ostringstream os;
+          os << "Frequency: " << f_grid[f_index] / 1e9 << " GHz \n";
+          out2 << os.str();
+
+          Tensor6 cloudbox_field_mono_local =
+              cloudbox_field(f_index, joker, joker, joker, joker, joker, joker);
+
+          // Start from the converged field of the previous frequency, shifted
+          // by the change of the first guess between the two frequencies.
+          // This keeps the boundary conditions of this frequency.
+          if (warm_start_chunk > 0) {
+            const Tensor6 first_guess = cloudbox_field_mono_local;
+            if (f_index > f_start) {
+              cloudbox_field_mono_local -= prev_first_guess;
+              cloudbox_field_mono_local += prev_field;
+            }
+            prev_first_guess = first_guess;
+          }
 
-      try {
-        ostringstream os;
-        os << "Frequency: " << f_grid[f_index] / 1e9 << " GHz \n";
-        out2 << os.str();
-
-        Tensor6 cloudbox_field_mono_local =
-            cloudbox_field(f_index, joker, joker, joker, joker, joker, joker);
-        doit_mono_agendaExecute(l_ws,
-                                cloudbox_field_mono_local,
-                                f_grid,
-                                f_index,
-                                l_doit_mono_agenda);
-        cloudbox_field(f_index, joker, joker, joker, joker, joker, joker) =
-            cloudbox_field_mono_local;
-      } catch (const std::exception& e) {
-        cloudbox_field(f_index, joker, joker, joker, joker, joker, joker) = NAN;
-        ostringstream os;
-        os << "Error for f_index = " << f_index << " (" << f_grid[f_index]
-           << " Hz)" << endl
-           << e.what();
+          doit_mono_agendaExecute(l_ws,
+                                  cloudbox_field_mono_local,
+                                  f_grid,
+                                  f_index,
+                                  l_doit_mono_agenda);
+          cloudbox_field(f_index, joker, joker, joker, joker, joker, joker) =
+              cloudbox_field_mono_local;
+
+          if (warm_start_chunk > 0) prev_field = cloudbox_field_mono_local;
+        } catch (const std::exception& e) {
+          cloudbox_field(f_index, joker, joker, joker, joker, joker, joker) =
+              NAN;
+          ostringstream os;
+          os << "Error for f_index = " << f_index << " (" << f_grid[f_index]
+             << " Hz)" << endl
+             << e.what();
 #pragma omp critical(DoitCalc_fail)
-        {
-          failed = true;
-          fail_msg = os.str();
+          {
+            failed = true;
+            fail_msg = os.str();
+          }
+          continue;
         }
-        continue;
       }
     }
 
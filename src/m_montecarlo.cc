@@ -31,8 +31,10 @@
 #include <cmath>
 #include <ctime>
 #include <fstream>
+#include <map>
 #include <stdexcept>
 #include "arts.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "check_input.h"
 #include "lin_alg.h"
@@ -129,6 +131,7 @@ void MCGeneral(Workspace& ws,
                const Numeric& taustep_limit,
                const Index& l_mc_scat_order,
                const Index& t_interp_order,
+               const Index& stream_length,
                const Verbosity& verbosity) {
   // Checks of input
   //
@@ -199,12 +202,8 @@ void MCGeneral(Workspace& ws,
     throw runtime_error(os.str());
   }
 
-  Ppath ppath_step;
-  Rng rng;  //Random Number generator
   time_t start_time = time(NULL);
   Index N_se = pnd_field.nbooks();  //Number of scattering elements
-  Vector pnd_vec(
-      N_se);  //Vector of particle number densities used at each point
   Vector Z11maxvector(
       N_se);  //Vector holding the maximum phase function for each
 
@@ -219,19 +218,8 @@ void MCGeneral(Workspace& ws,
     }
   }
 
-  rng.seed(mc_seed, verbosity);
-  Numeric g, temperature, albedo, g_los_csc_theta;
-  Matrix A(stokes_dim, stokes_dim), Q(stokes_dim, stokes_dim);
-  Matrix evol_op(stokes_dim, stokes_dim), ext_mat_mono(stokes_dim, stokes_dim);
-  Matrix q(stokes_dim, stokes_dim), newQ(stokes_dim, stokes_dim);
-  Matrix Z(stokes_dim, stokes_dim);
-  Matrix R_ant2enu(3, 3),
-      R_stokes(stokes_dim, stokes_dim);  // Needed for antenna rotations
-  q = 0.0;
-  newQ = 0.0;
-  Vector vector1(stokes_dim), abs_vec_mono(stokes_dim), I_i(stokes_dim);
+  Matrix R_ant2enu(3, 3);  // Needed for antenna rotations
   Vector Isum(stokes_dim), Isquaredsum(stokes_dim);
-  Index termination_flag = 0;
   const Numeric f_mono = f_grid[f_index];
   const Numeric prop_dir =
       -1.0;  // propagation direction opposite of los angles
@@ -250,15 +238,6 @@ void MCGeneral(Workspace& ws,
   mc_source_domain.resize(4);
   mc_source_domain = 0;
 
-  //local versions of workspace
-  Numeric local_surface_skin_t;
-  Matrix local_iy(1, stokes_dim), local_surface_emission(1, stokes_dim);
-  Matrix local_surface_los;
-  Tensor4 local_surface_rmatrix;
-  Vector local_rte_pos(3);  // Fixed this (changed from 2 to 3)
-  Vector local_rte_los(2);
-  Vector new_rte_los(2);
-  Index np;
   Isum = 0.0;
   Isquaredsum = 0.0;
   Numeric std_err_i;
@@ -279,262 +258,515 @@ void MCGeneral(Workspace& ws,
   // Calculate rotation matrix for boresight
   rotmat_enu(R_ant2enu, sensor_los(0, joker));
 
-  //Begin Main Loop
+  // Traces a single photon, drawing all random numbers from rng.
   //
-  bool keepgoing, oksampling;
-  Index nfails = 0;
-  //
-  while (true) {
-    // Complete content of while inside try/catch to handle occasional
-    // failures in the ppath calculations
-    try {
-      bool inside_cloud;
-
-      mc_iteration_count += 1;
-      Index scattering_order = 0;
-
-      keepgoing = true;   // indicating whether to continue tracing a photon
-      oksampling = true;  // gets false if g becomes zero
-
-      //Sample a FOV direction
-      Matrix R_prop(3, 3);
-      mc_antenna.draw_los(
-          local_rte_los, R_prop, rng, R_ant2enu, sensor_los(0, joker));
-
-      // Get stokes rotation matrix for rotating polarization
-      rotmat_stokes(
-          R_stokes, stokes_dim, prop_dir, prop_dir, R_prop, R_ant2enu);
-      id_mat(Q);
-      local_rte_pos = sensor_pos(0, joker);
-      I_i = 0.0;
-
-      while (keepgoing) {
-        mcPathTraceGeneral(ws,
-                           evol_op,
-                           abs_vec_mono,
-                           temperature,
-                           ext_mat_mono,
-                           rng,
-                           local_rte_pos,
-                           local_rte_los,
-                           pnd_vec,
-                           g,
-                           ppath_step,
-                           termination_flag,
-                           inside_cloud,
-                           ppath_step_agenda,
-                           ppath_lmax,
-                           ppath_lraytrace,
-                           taustep_limit,
-                           propmat_clearsky_agenda,
-                           stokes_dim,
-                           f_index,
-                           f_grid,
-                           p_grid,
-                           lat_grid,
-                           lon_grid,
-                           z_field,
-                           refellipsoid,
-                           z_surface,
-                           t_field,
-                           vmr_field,
-                           cloudbox_limits,
-                           pnd_field,
-                           scat_data,
-                           verbosity);
-
-        // GH 2011-09-08: if the lowest layer has large
-        // extent and a thick cloud, g may be 0 due to
-        // underflow, but then I_i should be 0 as well.
-        // Don't turn it into nan for no reason.
-        // If reaching underflow, no point in going on;
-        // hence new photon.
-        // GH 2011-09-14: moved this check to outside the different
-        // scenarios, as this goes wrong regardless of the scenario.
-        if (g == 0) {
-          keepgoing = false;
-          oksampling = false;
-          mc_iteration_count -= 1;
-          out0 << "WARNING: A rejected path sampling (g=0)!\n(if this"
-               << "happens repeatedly, try to decrease *ppath_lmax*)";
-        } else if (termination_flag == 1) {
-          iy_space_agendaExecute(ws,
-                                 local_iy,
-                                 Vector(1, f_mono),
-                                 local_rte_pos,
-                                 local_rte_los,
-                                 iy_space_agenda);
-          mult(vector1, evol_op, local_iy(0, joker));
-          mult(I_i, Q, vector1);
-          I_i /= g;
-          keepgoing = false;  //stop here. New photon.
-          mc_source_domain[0] += 1;
-        } else if (termination_flag == 2) {
-          //Calculate surface properties
-          surface_rtprop_agendaExecute(ws,
-                                       local_surface_skin_t,
-                                       local_surface_emission,
-                                       local_surface_los,
-                                       local_surface_rmatrix,
-                                       Vector(1, f_mono),
-                                       local_rte_pos,
-                                       local_rte_los,
-                                       surface_rtprop_agenda);
-
-          //if( local_surface_los.nrows() > 1 )
-          // throw runtime_error(
-          //                "The method handles only specular reflections." );
-
-          //deal with blackbody case
-          if (local_surface_los.empty()) {
-            mult(vector1, evol_op, local_surface_emission(0, joker));
-            mult(I_i, Q, vector1);
-            I_i /= g;
-            keepgoing = false;
-            mc_source_domain[1] += 1;
-          } else
-          //decide between reflection and emission
-          {
-            const Numeric rnd = rng.draw();
+  // Returns false if the path sampling was rejected (g=0).  Otherwise I_i
+  // holds the contribution of the photon, source_domain the index in
+  // *mc_source_domain* of where it was emitted and ppath_step the last
+  // path step, ending at the source.
+  const auto trace_photon = [&](Workspace& l_ws,
+                                Rng& rng,
+                                const Agenda& l_ppath_step_agenda,
+                                const Agenda& l_iy_space_agenda,
+                                const Agenda& l_surface_rtprop_agenda,
+                                const Agenda& l_propmat_clearsky_agenda,
+                                Vector& I_i,
+                                Matrix& R_stokes,
+                                Index& scattering_order,
+                                Index& source_domain,
+                                Ppath& ppath_step) -> bool {
+    Numeric g, temperature, albedo, g_los_csc_theta;
+    Matrix Q(stokes_dim, stokes_dim);
+    Matrix evol_op(stokes_dim, stokes_dim),
+        ext_mat_mono(stokes_dim, stokes_dim);
+    Matrix q(stokes_dim, stokes_dim, 0.0), newQ(stokes_dim, stokes_dim, 0.0);
+    Matrix Z(stokes_dim, stokes_dim);
+    Vector vector1(stokes_dim), abs_vec_mono(stokes_dim);
+    Vector pnd_vec(
+        N_se);  //Vector of particle number densities used at each point
+    Index termination_flag = 0;
+    bool inside_cloud;
 
-            Numeric R11 = 0;
-            for (Index i = 0; i < local_surface_rmatrix.nbooks(); i++) {
-              R11 += local_surface_rmatrix(i, 0, 0, 0);
-            }
+    //local versions of workspace
+    Numeric local_surface_skin_t;
+    Matrix local_iy(1, stokes_dim), local_surface_emission(1, stokes_dim);
+    Matrix local_surface_los;
+    Tensor4 local_surface_rmatrix;
+    Vector local_rte_pos(3);  // Fixed this (changed from 2 to 3)
+    Vector local_rte_los(2);
+    Vector new_rte_los(2);
 
-            if (rnd > R11) {
-              //then we have emission
-              mult(vector1, evol_op, local_surface_emission(0, joker));
-              mult(I_i, Q, vector1);
-              I_i /= g * (1 - R11);
-              keepgoing = false;
-              mc_source_domain[1] += 1;
-            } else {
-              //we have reflection
-              // determine which reflection los to use
-              Index i = 0;
-              Numeric rsum = local_surface_rmatrix(i, 0, 0, 0);
-              while (rsum < rnd) {
-                i++;
-                rsum += local_surface_rmatrix(i, 0, 0, 0);
-              }
+    scattering_order = 0;
 
-              local_rte_los = local_surface_los(i, joker);
+    //Sample a FOV direction
+    Matrix R_prop(3, 3);
+    mc_antenna.draw_los(
+        local_rte_los, R_prop, rng, R_ant2enu, sensor_los(0, joker));
 
-              mult(q, evol_op, local_surface_rmatrix(i, 0, joker, joker));
-              mult(newQ, Q, q);
-              Q = newQ;
-              Q /= g * local_surface_rmatrix(i, 0, 0, 0);
-            }
+    // Get stokes rotation matrix for rotating polarization
+    rotmat_stokes(R_stokes, stokes_dim, prop_dir, prop_dir, R_prop, R_ant2enu);
+    id_mat(Q);
+    local_rte_pos = sensor_pos(0, joker);
+    I_i.resize(stokes_dim);
+    I_i = 0.0;
+
+    while (true) {
+      mcPathTraceGeneral(l_ws,
+                         evol_op,
+                         abs_vec_mono,
+                         temperature,
+                         ext_mat_mono,
+                         rng,
+                         local_rte_pos,
+                         local_rte_los,
+                         pnd_vec,
+                         g,
+                         ppath_step,
+                         termination_flag,
+                         inside_cloud,
+                         l_ppath_step_agenda,
+                         ppath_lmax,
+                         ppath_lraytrace,
+                         taustep_limit,
+                         l_propmat_clearsky_agenda,
+                         stokes_dim,
+                         f_index,
+                         f_grid,
+                         p_grid,
+                         lat_grid,
+                         lon_grid,
+                         z_field,
+                         refellipsoid,
+                         z_surface,
+                         t_field,
+                         vmr_field,
+                         cloudbox_limits,
+                         pnd_field,
+                         scat_data,
+                         verbosity);
+
+      // GH 2011-09-08: if the lowest layer has large
+      // extent and a thick cloud, g may be 0 due to
+      // underflow, but then I_i should be 0 as well.
+      // Don't turn it into nan for no reason.
+      // If reaching underflow, no point in going on;
+      // hence new photon.
+      // GH 2011-09-14: moved this check to outside the different
+      // scenarios, as this goes wrong regardless of the scenario.
+      if (g == 0) {
+        return false;
+      } else if (termination_flag == 1) {
+        iy_space_agendaExecute(l_ws,
+                               local_iy,
+                               Vector(1, f_mono),
+                               local_rte_pos,
+                               local_rte_los,
+                               l_iy_space_agenda);
+        mult(vector1, evol_op, local_iy(0, joker));
+        mult(I_i, Q, vector1);
+        I_i /= g;
+        source_domain = 0;
+        return true;  //stop here. New photon.
+      } else if (termination_flag == 2) {
+        //Calculate surface properties
+        surface_rtprop_agendaExecute(l_ws,
+                                     local_surface_skin_t,
+                                     local_surface_emission,
+                                     local_surface_los,
+                                     local_surface_rmatrix,
+                                     Vector(1, f_mono),
+                                     local_rte_pos,
+                                     local_rte_los,
+                                     l_surface_rtprop_agenda);
+
+        //if( local_surface_los.nrows() > 1 )
+        // throw runtime_error(
+        //                "The method handles only specular reflections." );
+
+        //deal with blackbody case
+        if (local_surface_los.empty()) {
+          mult(vector1, evol_op, local_surface_emission(0, joker));
+          mult(I_i, Q, vector1);
+          I_i /= g;
+          source_domain = 1;
+          return true;
+        } else
+        //decide between reflection and emission
+        {
+          const Numeric rnd = rng.draw();
+
+          Numeric R11 = 0;
+          for (Index i = 0; i < local_surface_rmatrix.nbooks(); i++) {
+            R11 += local_surface_rmatrix(i, 0, 0, 0);
           }
-        } else if (inside_cloud) {
-          //we have another scattering/emission point
-          //Estimate single scattering albedo
-          albedo = 1 - abs_vec_mono[0] / ext_mat_mono(0, 0);
-
-          //determine whether photon is emitted or scattered
-          if (rng.draw() > albedo) {
-            //Calculate emission
-            Numeric planck_value = planck(f_mono, temperature);
-            Vector emission = abs_vec_mono;
-            emission *= planck_value;
-            Vector emissioncontri(stokes_dim);
-            mult(emissioncontri, evol_op, emission);
-            emissioncontri /= (g * (1 - albedo));  //yuck!
-            mult(I_i, Q, emissioncontri);
-            keepgoing = false;
-            mc_source_domain[3] += 1;
+
+          if (rnd > R11) {
+            //then we have emission
+            mult(vector1, evol_op, local_surface_emission(0, joker));
+            mult(I_i, Q, vector1);
+            I_i /= g * (1 - R11);
+            source_domain = 1;
+            return true;
           } else {
-            //we have a scattering event
-            Sample_los(new_rte_los,
-                       g_los_csc_theta,
-                       Z,
-                       rng,
-                       local_rte_los,
-                       scat_data,
-                       f_index,
-                       stokes_dim,
-                       pnd_vec,
-                       Z11maxvector,
-                       ext_mat_mono(0, 0) - abs_vec_mono[0],
-                       temperature,
-                       t_interp_order);
+            //we have reflection
+            // determine which reflection los to use
+            Index i = 0;
+            Numeric rsum = local_surface_rmatrix(i, 0, 0, 0);
+            while (rsum < rnd) {
+              i++;
+              rsum += local_surface_rmatrix(i, 0, 0, 0);
+            }
 
-            Z /= g * g_los_csc_theta * albedo;
+            local_rte_los = local_surface_los(i, joker);
 
-            mult(q, evol_op, Z);
+            mult(q, evol_op, local_surface_rmatrix(i, 0, joker, joker));
             mult(newQ, Q, q);
             Q = newQ;
-            scattering_order += 1;
-            local_rte_los = new_rte_los;
+            Q /= g * local_surface_rmatrix(i, 0, 0, 0);
           }
-        } else {
-          //Must be clear sky emission point
+        }
+      } else if (inside_cloud) {
+        //we have another scattering/emission point
+        //Estimate single scattering albedo
+        albedo = 1 - abs_vec_mono[0] / ext_mat_mono(0, 0);
+
+        //determine whether photon is emitted or scattered
+        if (rng.draw() > albedo) {
           //Calculate emission
           Numeric planck_value = planck(f_mono, temperature);
           Vector emission = abs_vec_mono;
           emission *= planck_value;
           Vector emissioncontri(stokes_dim);
           mult(emissioncontri, evol_op, emission);
-          emissioncontri /= g;
+          emissioncontri /= (g * (1 - albedo));  //yuck!
           mult(I_i, Q, emissioncontri);
-          keepgoing = false;
-          mc_source_domain[2] += 1;
-        }
-      }  // keepgoing
-
-      if (oksampling) {
-        // Set spome of the bookkeeping variables
-        np = ppath_step.np;
-        mc_points(ppath_step.gp_p[np - 1].idx,
-                  ppath_step.gp_lat[np - 1].idx,
-                  ppath_step.gp_lon[np - 1].idx) += 1;
-        if (scattering_order < l_mc_scat_order) {
-          mc_scat_order[scattering_order] += 1;
+          source_domain = 3;
+          return true;
+        } else {
+          //we have a scattering event
+          Sample_los(new_rte_los,
+                     g_los_csc_theta,
+                     Z,
+                     rng,
+                     local_rte_los,
+                     scat_data,
+                     f_index,
+                     stokes_dim,
+                     pnd_vec,
+                     Z11maxvector,
+                     ext_mat_mono(0, 0) - abs_vec_mono[0],
+                     temperature,
+                     t_interp_order);
+
+          Z /= g * g_los_csc_theta * albedo;
+
+          mult(q, evol_op, Z);
+          mult(newQ, Q, q);
+          Q = newQ;
+          scattering_order += 1;
+          local_rte_los = new_rte_los;
         }
+      } else {
+        //Must be clear sky emission point
+        //Calculate emission
+        Numeric planck_value = planck(f_mono, temperature);
+        Vector emission = abs_vec_mono;
+        emission *= planck_value;
+        Vector emissioncontri(stokes_dim);
+        mult(emissioncontri, evol_op, emission);
+        emissioncontri /= g;
+        mult(I_i, Q, emissioncontri);
+        source_domain = 2;
+        return true;
+      }
+    }
+  };
+
+  if (stream_length <= 0) {
+    Rng rng;  //Random Number generator
+    rng.seed(mc_seed, verbosity);
+
+    Ppath ppath_step;
+    Vector I_i(stokes_dim);
+    Matrix R_stokes(stokes_dim, stokes_dim);
+    Index scattering_order, source_domain;
+
+    //Begin Main Loop
+    //
+    Index nfails = 0;
+    //
+    while (true) {
+      // Complete content of while inside try/catch to handle occasional
+      // failures in the ppath calculations
+      try {
+        mc_iteration_count += 1;
+
+        if (!trace_photon(ws,
+                          rng,
+                          ppath_step_agenda,
+                          iy_space_agenda,
+                          surface_rtprop_agenda,
+                          propmat_clearsky_agenda,
+                          I_i,
+                          R_stokes,
+                          scattering_order,
+                          source_domain,
+                          ppath_step)) {
+          mc_iteration_count -= 1;
+          out0 << "WARNING: A rejected path sampling (g=0)!\n(if this"
+               << "happens repeatedly, try to decrease *ppath_lmax*)";
+        } else {
+          mc_source_domain[source_domain] += 1;
+
+          // Set spome of the bookkeeping variables
+          const Index np = ppath_step.np;
+          mc_points(ppath_step.gp_p[np - 1].idx,
+                    ppath_step.gp_lat[np - 1].idx,
+                    ppath_step.gp_lon[np - 1].idx) += 1;
+          if (scattering_order < l_mc_scat_order) {
+            mc_scat_order[scattering_order] += 1;
+          }
 
-        // Rotate into antenna polarization frame
-        Vector I_hold(stokes_dim);
-        mult(I_hold, R_stokes, I_i);
-        Isum += I_i;
+          // Rotate into antenna polarization frame
+          Vector I_hold(stokes_dim);
+          mult(I_hold, R_stokes, I_i);
+          Isum += I_i;
 
-        for (Index j = 0; j < stokes_dim; j++) {
-          assert(!std::isnan(I_i[j]));
-          Isquaredsum[j] += I_i[j] * I_i[j];
-        }
-        y = Isum;
-        y /= (Numeric)mc_iteration_count;
-        for (Index j = 0; j < stokes_dim; j++) {
-          mc_error[j] = sqrt(
-              (Isquaredsum[j] / (Numeric)mc_iteration_count - y[j] * y[j]) /
-              (Numeric)mc_iteration_count);
+          for (Index j = 0; j < stokes_dim; j++) {
+            assert(!std::isnan(I_i[j]));
+            Isquaredsum[j] += I_i[j] * I_i[j];
+          }
+          y = Isum;
+          y /= (Numeric)mc_iteration_count;
+          for (Index j = 0; j < stokes_dim; j++) {
+            mc_error[j] = sqrt(
+                (Isquaredsum[j] / (Numeric)mc_iteration_count - y[j] * y[j]) /
+                (Numeric)mc_iteration_count);
+          }
+          if (std_err > 0 && mc_iteration_count >= min_iter &&
+              mc_error[0] < std_err_i) {
+            break;
+          }
+          if (max_time > 0 && (Index)(time(NULL) - start_time) >= max_time) {
+            break;
+          }
+          if (max_iter > 0 && mc_iteration_count >= max_iter) {
+            break;
+          }
         }
-        if (std_err > 0 && mc_iteration_count >= min_iter &&
-            mc_error[0] < std_err_i) {
-          break;
+      }  // Try
+
+      catch (const std::runtime_error& e) {
+        mc_iteration_count += 1;
+        nfails += 1;
+        out0 << "WARNING: A MC path sampling failed! Error was:\n";
+        cout << e.what() << endl;
+        if (nfails >= 5) {
+          throw runtime_error(
+              "The MC path sampling has failed five times. A few failures "
+              "should be OK, but this number is suspiciously high and the "
+              "reason to these failures should be tracked down.");
         }
-        if (max_time > 0 && (Index)(time(NULL) - start_time) >= max_time) {
-          break;
+      }
+    }  // while
+  } else {
+    // The photons are divided into streams of stream_length photons.
+    // Stream s draws its random numbers from an own Rng seeded with
+    // mc_seed + s, so each photon sees the same random numbers whichever
+    // thread traces it.  The threads take streams one at a time.  The
+    // Stokes sums are kept per stream and added up in stream order at the
+    // end, so that they do not depend on which thread traced which stream.
+    // Only the photon count and the sums of the first Stokes element are
+    // shared, through atomic updates, to check the convergence criteria.
+    const Index max_photons = max_iter > 0 ? max_iter : -1;
+
+    Index photon_count = 0;
+    Numeric I0sum = 0, I0squaredsum = 0;
+    Index next_stream = 0;
+    Index nfails = 0;
+    bool done = false;
+    ArrayOfString fail_msg;
+    std::map<Index, Vector> stream_Isum, stream_Isquaredsum;
+
+    // We have to make a local copy of the Workspace and the agendas because
+    // only non-reference types can be declared firstprivate in OpenMP
+    Workspace l_ws(ws);
+    Agenda l_ppath_step_agenda(ppath_step_agenda);
+    Agenda l_iy_space_agenda(iy_space_agenda);
+    Agenda l_surface_rtprop_agenda(surface_rtprop_agenda);
+    Agenda l_propmat_clearsky_agenda(propmat_clearsky_agenda);
+
+#pragma omp parallel if (!arts_omp_in_parallel())                      \
+    firstprivate(l_ws,                                                 \
+                 l_ppath_step_agenda,                                  \
+                 l_iy_space_agenda,                                    \
+                 l_surface_rtprop_agenda,                              \
+                 l_propmat_clearsky_agenda)
+    {
+      Rng rng;
+      Ppath ppath_step;
+      Vector I_i(stokes_dim);
+      Matrix R_stokes(stokes_dim, stokes_dim);
+      Index scattering_order, source_domain;
+
+      // Thread-local counts, merged when the thread is done
+      Index l_count = 0;
+      Vector l_Isum(stokes_dim), l_Isquaredsum(stokes_dim);
+      Tensor3 l_points(
+          mc_points.npages(), mc_points.nrows(), mc_points.ncols(), 0);
+      ArrayOfIndex l_scat_order(l_mc_scat_order, 0);
+      ArrayOfIndex l_source_domain(4, 0);
+
+      while (true) {
+        bool l_done;
+#pragma omp atomic read
+        l_done = done;
+        if (l_done) break;
+
+        Index s;
+#pragma omp atomic capture
+        s = next_stream++;
+
+        const Index first = s * stream_length;
+        const Index last = max_photons > 0
+                               ? min(first + stream_length, max_photons)
+                               : first + stream_length;
+        if (first >= last) break;
+
+        rng.force_seed((unsigned long int)(mc_seed + s));
+        l_Isum = 0;
+        l_Isquaredsum = 0;
+
+        for (Index i = first; i < last;) {
+#pragma omp atomic read
+          l_done = done;
+          if (l_done) break;
+
+          bool counted = true;
+          Numeric dI0 = 0, dI0squared = 0;
+          try {
+            if (!trace_photon(l_ws,
+                              rng,
+                              l_ppath_step_agenda,
+                              l_iy_space_agenda,
+                              l_surface_rtprop_agenda,
+                              l_propmat_clearsky_agenda,
+                              I_i,
+                              R_stokes,
+                              scattering_order,
+                              source_domain,
+                              ppath_step)) {
+              // A rejected photon is drawn again from the same stream
+              counted = false;
+              ostringstream os;
+              os << "WARNING: A rejected path sampling (g=0)!\n(if this"
+                 << "happens repeatedly, try to decrease *ppath_lmax*)";
+              out0 << os.str();
+            } else {
+              l_source_domain[source_domain] += 1;
+
+              const Index np = ppath_step.np;
+              l_points(ppath_step.gp_p[np - 1].idx,
+                       ppath_step.gp_lat[np - 1].idx,
+                       ppath_step.gp_lon[np - 1].idx) += 1;
+              if (scattering_order < l_mc_scat_order) {
+                l_scat_order[scattering_order] += 1;
+              }
+
+              l_Isum += I_i;
+              for (Index j = 0; j < stokes_dim; j++) {
+                assert(!std::isnan(I_i[j]));
+                l_Isquaredsum[j] += I_i[j] * I_i[j];
+              }
+              dI0 = I_i[0];
+              dI0squared = I_i[0] * I_i[0];
+            }
+          } catch (const std::runtime_error& e) {
+            ostringstream os;
+            os << "WARNING: A MC path sampling failed! Error was:\n"
+               << e.what() << "\n";
+            out0 << os.str();
+
+            Index l_nfails;
+#pragma omp atomic capture
+            l_nfails = ++nfails;
+            if (l_nfails == 5) {
+#pragma omp critical(MCGeneral_push_fail_msg)
+              fail_msg.push_back(
+                  "The MC path sampling has failed five times. A few failures "
+                  "should be OK, but this number is suspiciously high and the "
+                  "reason to these failures should be tracked down.");
+#pragma omp atomic write
+              done = true;
+            }
+          }
+
+          if (!counted) continue;
+          i++;
+          l_count++;
+
+          // Merge into the shared totals and check for convergence
+          Index n;
+#pragma omp atomic capture
+          n = ++photon_count;
+#pragma omp atomic
+          I0sum += dI0;
+#pragma omp atomic
+          I0squaredsum += dI0squared;
+
+          bool stop = max_time > 0 &&
+                      (Index)(time(NULL) - start_time) >= max_time;
+          if (std_err > 0 && n >= min_iter) {
+            Numeric s0, s0squared;
+#pragma omp atomic read
+            s0 = I0sum;
+#pragma omp atomic read
+            s0squared = I0squaredsum;
+            const Numeric y0 = s0 / (Numeric)n;
+            if (sqrt((s0squared / (Numeric)n - y0 * y0) / (Numeric)n) <
+                std_err_i)
+              stop = true;
+          }
+          if (stop) {
+#pragma omp atomic write
+            done = true;
+          }
         }
-        if (max_iter > 0 && mc_iteration_count >= max_iter) {
-          break;
+
+#pragma omp critical(MCGeneral_merge)
+        {
+          stream_Isum[s] = l_Isum;
+          stream_Isquaredsum[s] = l_Isquaredsum;
         }
       }
-    }  // Try
-
-    catch (const std::runtime_error& e) {
-      mc_iteration_count += 1;
-      nfails += 1;
-      out0 << "WARNING: A MC path sampling failed! Error was:\n";
-      cout << e.what() << endl;
-      if (nfails >= 5) {
-        throw runtime_error(
-            "The MC path sampling has failed five times. A few failures "
-            "should be OK, but this number is suspiciously high and the "
-            "reason to these failures should be tracked down.");
+
+#pragma omp critical(MCGeneral_merge)
+      {
+        mc_iteration_count += l_count;
+        mc_points += l_points;
+        for (Index i = 0; i < l_mc_scat_order; i++)
+          mc_scat_order[i] += l_scat_order[i];
+        for (Index i = 0; i < 4; i++)
+          mc_source_domain[i] += l_source_domain[i];
+      }
+    }
+
+    if (fail_msg.nelem()) throw runtime_error(fail_msg[0]);
+
+    // The map is ordered by stream
+    for (auto& x : stream_Isum) Isum += x.second;
+    for (auto& x : stream_Isquaredsum) Isquaredsum += x.second;
+
+    if (mc_iteration_count > 0) {
+      y = Isum;
+      y /= (Numeric)mc_iteration_count;
+      for (Index j = 0; j < stokes_dim; j++) {
+        mc_error[j] = sqrt(
+            (Isquaredsum[j] / (Numeric)mc_iteration_count - y[j] * y[j]) /
+            (Numeric)mc_iteration_count);
       }
     }
-  }  // while
+  }
 
   if (convert_to_rjbt) {
     for (Index j = 0; j < stokes_dim; j++) {
@@ -587,6 +819,7 @@ void MCRadar(  // Workspace reference:
     const Numeric& ze_tref,
     const Numeric& k2,
     const Index& t_interp_order,
+    const Index& stream_length,
     // Verbosity object:
     const Verbosity& verbosity) {
   CREATE_OUT0;
@@ -669,43 +902,14 @@ void MCRadar(  // Workspace reference:
         "Gaussian antenna patterns.");
   }
 
-  Ppath ppath_step;
-  Rng rng;                          //Random Number generator
   Index N_se = pnd_field.nbooks();  //Number of scattering elements
-  Vector pnd_vec(
-      N_se);  //Vector of particle number densities used at each point
   bool anyptype_nonTotRan = is_anyptype_nonTotRan(scat_data);
   bool is_dist = max(range_bins) > 1;  // Is it round trip time or distance
-  rng.seed(mc_seed, verbosity);
-  Numeric ppath_lraytrace_var;
-  //Numeric temperature, albedo;
-  Numeric albedo;
-  Numeric Csca, Cext;
-  Numeric antenna_wgt;
-  Matrix evol_op(stokes_dim, stokes_dim), ext_mat_mono(stokes_dim, stokes_dim);
-  Matrix trans_mat(stokes_dim, stokes_dim);
-  Matrix Z(stokes_dim, stokes_dim);
-  Matrix R_ant2enu(3, 3), R_enu2ant(3, 3), R_stokes(stokes_dim, stokes_dim);
-  Vector abs_vec_mono(stokes_dim), I_i(stokes_dim), I_i_rot(stokes_dim);
+  Matrix R_ant2enu(3, 3), R_enu2ant(3, 3);
   Vector Isum(nbins * stokes_dim), Isquaredsum(nbins * stokes_dim);
-  Index termination_flag = 0;
   Vector bin_height(nbins);
   Vector range_bin_count(nbins);
   Index mc_iter;
-  Index scat_order;
-
-  // allocating variables needed for pha_mat extraction (don't want to do this
-  // in every loop step again).
-  ArrayOfArrayOfTensor6 pha_mat_Nse;
-  ArrayOfArrayOfIndex ptypes_Nse;
-  Matrix t_ok;
-  ArrayOfTensor6 pha_mat_ssbulk;
-  ArrayOfIndex ptype_ssbulk;
-  Tensor6 pha_mat_bulk;
-  Index ptype_bulk;
-  Matrix pdir_array(1, 2), idir_array(1, 2);
-  Vector t_array(1);
-  Matrix pnds(N_se, 1);
 
   // for pha_mat handling, at the moment we still need scat_data_mono. Hence,
   // extract that here (but in its local container, not into the WSV
@@ -732,20 +936,10 @@ void MCRadar(  // Workspace reference:
   mc_iter = 0;
   // this will need to be reshaped differently for range gates
   mc_error.resize(stokes_dim * nbins);
+  mc_error = 0;
 
-  //local versions of workspace
-  Matrix local_iy(1, stokes_dim), local_surface_emission(1, stokes_dim);
-  Matrix local_surface_los;
-  Tensor4 local_surface_rmatrix;
-  Vector local_rte_pos(3);
-  Vector local_rte_los(2);
-  Vector new_rte_los(2);
-  Vector Ipath(stokes_dim), Ihold(stokes_dim), Ipath_norm(stokes_dim);
   Isum = 0.0;
   Isquaredsum = 0.0;
-  Numeric s_tot, s_return;  // photon distance traveled
-  Numeric t_tot, t_return;  // photon time traveled
-  Numeric r_trav, r_bin;  // range traveled (1-way distance) or round-trip time
 
   Numeric fac;
   if (iy_unit == "1") {
@@ -768,13 +962,57 @@ void MCRadar(  // Workspace reference:
   rotmat_enu(R_ant2enu, sensor_los(0, joker));
   R_enu2ant = transpose(R_ant2enu);
 
-  //Begin Main Loop
-  bool keepgoing, firstpass, integrity;
-  while (mc_iter < mc_max_iter) {
+  // Traces a single photon, drawing all random numbers from rng, and adds
+  // its reflectivity contributions to the range bin sums
+  const auto trace_photon = [&](Workspace& l_ws,
+                                Rng& rng,
+                                const Agenda& l_ppath_step_agenda,
+                                const Agenda& l_propmat_clearsky_agenda,
+                                Vector& l_Isum,
+                                Vector& l_Isquaredsum,
+                                Vector& l_range_bin_count) {
+    Ppath ppath_step;
+    Vector pnd_vec(
+        N_se);  //Vector of particle number densities used at each point
+    Numeric ppath_lraytrace_var;
+    //Numeric temperature, albedo;
+    Numeric albedo;
+    Numeric Csca, Cext;
+    Numeric antenna_wgt;
+    Matrix evol_op(stokes_dim, stokes_dim),
+        ext_mat_mono(stokes_dim, stokes_dim);
+    Matrix trans_mat(stokes_dim, stokes_dim);
+    Matrix Z(stokes_dim, stokes_dim);
+    Matrix R_stokes(stokes_dim, stokes_dim);
+    Vector abs_vec_mono(stokes_dim), I_i(stokes_dim), I_i_rot(stokes_dim);
+    Index termination_flag = 0;
+    Index scat_order;
+
+    // allocating variables needed for pha_mat extraction (don't want to do
+    // this in every loop step again).
+    ArrayOfArrayOfTensor6 pha_mat_Nse;
+    ArrayOfArrayOfIndex ptypes_Nse;
+    Matrix t_ok;
+    ArrayOfTensor6 pha_mat_ssbulk;
+    ArrayOfIndex ptype_ssbulk;
+    Tensor6 pha_mat_bulk;
+    Index ptype_bulk;
+    Matrix pdir_array(1, 2), idir_array(1, 2);
+    Vector t_array(1);
+    Matrix pnds(N_se, 1);
+
+    //local versions of workspace
+    Vector local_rte_pos(3);
+    Vector local_rte_los(2);
+    Vector new_rte_los(2);
+    Vector Ipath(stokes_dim), Ihold(stokes_dim), Iscat(stokes_dim);
+    Numeric s_tot, s_return;  // photon distance traveled
+    Numeric t_tot, t_return;  // photon time traveled
+    Numeric r_trav;  // range traveled (1-way distance) or round-trip time
+
+    bool keepgoing, firstpass, integrity;
     bool inside_cloud;
 
-    mc_iter += 1;
-
     integrity = true;  // intensity is not nan or below threshold
     keepgoing = true;  // indicating whether to continue tracing a photon
     firstpass = true;  // ensure backscatter is properly calculated
@@ -794,7 +1032,7 @@ void MCRadar(  // Workspace reference:
     while (keepgoing) {
       Numeric s_path, t_path;
 
-      mcPathTraceRadar(ws,
+      mcPathTraceRadar(l_ws,
                        evol_op,
                        abs_vec_mono,
                        t_array[0],
@@ -808,10 +1046,10 @@ void MCRadar(  // Workspace reference:
                        ppath_step,
                        termination_flag,
                        inside_cloud,
-                       ppath_step_agenda,
+                       l_ppath_step_agenda,
                        ppath_lmax,
                        ppath_lraytrace,
-                       propmat_clearsky_agenda,
+                       l_propmat_clearsky_agenda,
                        anyptype_nonTotRan,
                        stokes_dim,
                        f_index,
@@ -897,11 +1135,11 @@ void MCRadar(  // Workspace reference:
                                             local_rte_pos,
                                             verbosity);
 
-        ppathFromRtePos2(ws,
+        ppathFromRtePos2(l_ws,
                          ppath,
                          rte_los_antenna,
                          ppath_lraytrace_var,
-                         ppath_step_agenda,
+                         l_ppath_step_agenda,
                          atmosphere_dim,
                          p_grid,
                          lat_grid,
@@ -941,22 +1179,6 @@ void MCRadar(  // Workspace reference:
 
         // Still within max range of radar?
         if (r_trav <= r_max) {
-          // Compute path extinction as with radio link
-          get_ppath_transmat(ws,
-                             trans_mat,
-                             ppath,
-                             propmat_clearsky_agenda,
-                             stokes_dim,
-                             f_index,
-                             f_grid,
-                             p_grid,
-                             t_field,
-                             vmr_field,
-                             cloudbox_limits,
-                             pnd_field,
-                             scat_data,
-                             verbosity);
-
           // Obtain scattering matrix given incident and scattered angles
           Matrix P(stokes_dim, stokes_dim);
 
@@ -988,8 +1210,7 @@ void MCRadar(  // Workspace reference:
           mult(Ipath, evol_op, Ihold);
           Ipath /= Ipath[0];
           Ipath *= Ihold[0];
-          mult(Ihold, P, Ipath);
-          mult(I_i, trans_mat, Ihold);
+          mult(Iscat, P, Ipath);
           Ihold = Ipath;
           if (Ihold[0] < 1e-40 || std::isnan(Ihold[0]) ||
               std::isnan(Ihold[1]) ||
@@ -999,35 +1220,61 @@ void MCRadar(  // Workspace reference:
           }
 
           if (r_trav > r_min && integrity) {
-            // Add reflectivity to proper range bin
-            Index ibin = 0;
-            r_bin = 0.0;
-            while (r_bin < r_trav && ibin <= nbins + 1) {
-              ibin++;
-              r_bin = range_bins[ibin];
+            // Find the range bin, range_bins[ibin] < r_trav <= range_bins[ibin+1]
+            Index ibin = 0, iend = nbins;
+            while (iend - ibin > 1) {
+              const Index imid = (ibin + iend) / 2;
+              if (range_bins[imid] < r_trav)
+                ibin = imid;
+              else
+                iend = imid;
             }
-            ibin -= 1;
 
             // Calculate rx antenna weight and polarization rotation
             Matrix R_rx(3, 3);
             rotmat_enu(R_rx, rte_los_antenna);
             mc_antenna.return_los(antenna_wgt, R_rx, R_enu2ant);
-            rotmat_stokes(
-                R_stokes, stokes_dim, rx_dir, tx_dir, R_rx, R_ant2enu);
-            mult(I_i_rot, R_stokes, I_i);
 
+            // The path extinction is only needed for photons that reach a
+            // range bin and return inside the antenna pattern
+            if (antenna_wgt > 0) {
+              // Compute path extinction as with radio link
+              get_ppath_transmat(l_ws,
+                                 trans_mat,
+                                 ppath,
+                                 l_propmat_clearsky_agenda,
+                                 stokes_dim,
+                                 f_index,
+                                 f_grid,
+                                 p_grid,
+                                 t_field,
+                                 vmr_field,
+                                 cloudbox_limits,
+                                 pnd_field,
+                                 scat_data,
+                                 verbosity);
+              mult(I_i, trans_mat, Iscat);
+              rotmat_stokes(
+                  R_stokes, stokes_dim, rx_dir, tx_dir, R_rx, R_ant2enu);
+              mult(I_i_rot, R_stokes, I_i);
+              I_i_rot *= antenna_wgt;
+            } else {
+              I_i_rot = 0;
+            }
+
+            VectorView Ibin = l_Isum[Range(ibin * stokes_dim, stokes_dim)];
+            VectorView I2bin =
+                l_Isquaredsum[Range(ibin * stokes_dim, stokes_dim)];
             for (Index istokes = 0; istokes < stokes_dim; istokes++) {
-              Index ibiny = ibin * stokes_dim + istokes;
               assert(!std::isnan(I_i_rot[istokes]));
-              Isum[ibiny] += antenna_wgt * I_i_rot[istokes];
-              Isquaredsum[ibiny] += antenna_wgt * antenna_wgt *
-                                    I_i_rot[istokes] * I_i_rot[istokes];
+              Ibin[istokes] += I_i_rot[istokes];
+              I2bin[istokes] += I_i_rot[istokes] * I_i_rot[istokes];
             }
-            range_bin_count[ibin] += 1;
+            l_range_bin_count[ibin] += 1;
           }
 
           scat_order++;
-            
+
           Sample_los_uniform(new_rte_los, rng);
           pdir_array(0, joker) = new_rte_los;
           // alt:
@@ -1071,8 +1318,83 @@ void MCRadar(  // Workspace reference:
       if (scat_order >= mc_max_scatorder) keepgoing = false;
       if (!integrity) keepgoing = false;
     }  // while (inner: keepgoing)
+  };
+
+  if (stream_length <= 0) {
+    Rng rng;  //Random Number generator
+    rng.seed(mc_seed, verbosity);
+
+    //Begin Main Loop
+    while (mc_iter < mc_max_iter) {
+      mc_iter += 1;
+      trace_photon(ws,
+                   rng,
+                   ppath_step_agenda,
+                   propmat_clearsky_agenda,
+                   Isum,
+                   Isquaredsum,
+                   range_bin_count);
+    }  // while (outer)
+  } else {
+    // The photons are divided into streams of stream_length photons, where
+    // stream s draws its random numbers from an own Rng seeded with
+    // mc_seed + s.  Each stream sums into its own range bins, and these are
+    // added together in stream order at the end, so that they do not depend
+    // on which thread traced which stream.
+    const Index nstreams = (mc_max_iter + stream_length - 1) / stream_length;
+    ArrayOfString fail_msg;
+    bool do_abort = false;
+    ArrayOfVector stream_Isum(nstreams, Vector(nbins * stokes_dim, 0));
+    ArrayOfVector stream_Isquaredsum(nstreams, Vector(nbins * stokes_dim, 0));
+
+    // We have to make a local copy of the Workspace and the agendas because
+    // only non-reference types can be declared firstprivate in OpenMP
+    Workspace l_ws(ws);
+    Agenda l_ppath_step_agenda(ppath_step_agenda);
+    Agenda l_propmat_clearsky_agenda(propmat_clearsky_agenda);
+
+#pragma omp parallel if (!arts_omp_in_parallel() && nstreams > 1) \
+    firstprivate(l_ws, l_ppath_step_agenda, l_propmat_clearsky_agenda)
+    {
+      Rng rng;
+      Vector l_range_bin_count(nbins, 0);
+
+#pragma omp for schedule(dynamic)
+      for (Index s = 0; s < nstreams; s++) {
+        if (do_abort) continue;
+        try {
+          rng.force_seed((unsigned long int)(mc_seed + s));
+          const Index last = min((s + 1) * stream_length, mc_max_iter);
+          for (Index i = s * stream_length; i < last; i++)
+            trace_photon(l_ws,
+                         rng,
+                         l_ppath_step_agenda,
+                         l_propmat_clearsky_agenda,
+                         stream_Isum[s],
+                         stream_Isquaredsum[s],
+                         l_range_bin_count);
+        } catch (const std::exception& e) {
+#pragma omp critical(MCRadar_setabort)
+          {
+            do_abort = true;
+            fail_msg.push_back(e.what());
+          }
+        }
+      }
 
-  }  // while (outer)
+#pragma omp critical(MCRadar_merge)
+      range_bin_count += l_range_bin_count;
+    }
+
+    if (fail_msg.nelem()) throw runtime_error(fail_msg[0]);
+
+    for (Index s = 0; s < nstreams; s++) {
+      Isum += stream_Isum[s];
+      Isquaredsum += stream_Isquaredsum[s];
+    }
+
+    mc_iter = mc_max_iter;
+  }
 
   // Normalize range bins and apply sensor response (polarization)
   for (Index ibin = 0; ibin < nbins; ibin++) {
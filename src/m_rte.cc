@@ -274,21 +274,33 @@ void iyEmissionStandard(
   ppvar_trans_partial.resize(np, nf, ns, ns);
   ppvar_iy.resize(nf, ns, np);
 
-  ArrayOfRadiationVector lvl_rad(np, RadiationVector(nf, ns));
+  // Unpolarised radiances without analytical Jacobians are computed by a
+  // scalar engine, holding absorption, source, and transmission as plain
+  // (np, nf) matrices instead of the general polarised types below
+  const bool scalar_rt = ns == 1 and not j_analytical_do and
+                         (rt_integration_option == "first order" or
+                          rt_integration_option == "default");
+  const Index npg = scalar_rt ? 0 : np;
+
+  Matrix scl_k(scalar_rt ? np : 0, nf);
+  Matrix scl_src(scalar_rt ? np : 0, nf, 0);
+  Matrix scl_tra(scalar_rt ? np : 0, nf, 1);
+
+  ArrayOfRadiationVector lvl_rad(npg, RadiationVector(nf, ns));
   ArrayOfArrayOfRadiationVector dlvl_rad(
-      np, ArrayOfRadiationVector(nq, RadiationVector(nf, ns)));
+      npg, ArrayOfRadiationVector(nq, RadiationVector(nf, ns)));
 
-  ArrayOfRadiationVector src_rad(np, RadiationVector(nf, ns));
+  ArrayOfRadiationVector src_rad(npg, RadiationVector(nf, ns));
   ArrayOfArrayOfRadiationVector dsrc_rad(
-      np, ArrayOfRadiationVector(nq, RadiationVector(nf, ns)));
+      npg, ArrayOfRadiationVector(nq, RadiationVector(nf, ns)));
 
-  ArrayOfTransmissionMatrix lyr_tra(np, TransmissionMatrix(nf, ns));
+  ArrayOfTransmissionMatrix lyr_tra(npg, TransmissionMatrix(nf, ns));
   ArrayOfArrayOfTransmissionMatrix dlyr_tra_above(
-      np, ArrayOfTransmissionMatrix(nq, TransmissionMatrix(nf, ns)));
+      npg, ArrayOfTransmissionMatrix(nq, TransmissionMatrix(nf, ns)));
   ArrayOfArrayOfTransmissionMatrix dlyr_tra_below(
-      np, ArrayOfTransmissionMatrix(nq, TransmissionMatrix(nf, ns)));
+      npg, ArrayOfTransmissionMatrix(nq, TransmissionMatrix(nf, ns)));
   
-  ArrayOfPropagationMatrix K(np, PropagationMatrix(nf, ns));
+  ArrayOfPropagationMatrix K(npg, PropagationMatrix(nf, ns));
   ArrayOfArrayOfPropagationMatrix dK_dx(np);
   Vector r(np);
   ArrayOfVector dr_below(np, Vector(nq, 0));
@@ -355,117 +367,164 @@ void iyEmissionStandard(
     const bool temperature_jacobian =
         j_analytical_do and do_temperature_jacobian(jacobian_quantities);
 
+    // Transmission of the layer between ppath points ip-1 and ip
+    auto layer_transmission = [&](const Index ip) {
+      if (scalar_rt) {
+        scalar_stepwise_transmission(scl_tra(ip, joker),
+                                     scl_k(ip - 1, joker),
+                                     scl_k(ip, joker),
+                                     ppath.lstep[ip - 1]);
+        return;
+      }
+
+      const Numeric dr_dT_past =
+          do_hse ? ppath.lstep[ip - 1] / (2.0 * ppvar_t[ip - 1]) : 0;
+      const Numeric dr_dT_this =
+          do_hse ? ppath.lstep[ip - 1] / (2.0 * ppvar_t[ip]) : 0;
+      stepwise_transmission(lyr_tra[ip],
+                            dlyr_tra_above[ip],
+                            dlyr_tra_below[ip],
+                            K[ip - 1],
+                            K[ip],
+                            dK_dx[ip - 1],
+                            dK_dx[ip],
+                            ppath.lstep[ip - 1],
+                            dr_dT_past,
+                            dr_dT_this,
+                            temperature_derivative_position);
+
+      r[ip - 1] = ppath.lstep[ip - 1];
+      if (temperature_derivative_position >= 0) {
+        dr_below[ip][temperature_derivative_position] = dr_dT_past;
+        dr_above[ip][temperature_derivative_position] = dr_dT_this;
+      }
+    };
+
+    // The ppath points are split in one contiguous block per thread. Each
+    // block is handled in one pass, where the layer transmission is computed
+    // as soon as the propagation matrices of both its points are known.
+    // Only the layers between blocks are left for after the loop. Every
+    // block keeps its own error message, so no synchronisation is needed.
+    const Index nblocks =
+        arts_omp_in_parallel()
+            ? 1
+            : min(np, max(Index(arts_omp_get_max_threads()), Index(1)));
+    const Index block_size = (np + nblocks - 1) / nblocks;
+    ArrayOfString fail_msg(nblocks);
+
     Agenda l_propmat_clearsky_agenda(propmat_clearsky_agenda);
     Workspace l_ws(ws);
-    ArrayOfString fail_msg;
-    bool do_abort = false;
+    PropagationMatrix K_scl(scalar_rt ? nf : 0, ns);
 
     // Loop ppath points and determine radiative properties
-#pragma omp parallel for if (!arts_omp_in_parallel()) \
-    firstprivate(l_ws, l_propmat_clearsky_agenda, a, B, dB_dT, S, da_dx, dS_dx)
-    for (Index ip = 0; ip < np; ip++) {
-      if (do_abort) continue;
+#pragma omp parallel for schedule(static, 1) if (nblocks > 1) \
+    firstprivate(                                              \
+        l_ws, l_propmat_clearsky_agenda, a, B, dB_dT, S, da_dx, dS_dx, K_scl)
+    for (Index ib = 0; ib < nblocks; ib++) {
+      const Index ip0 = ib * block_size;
+      const Index ip1 = min(np, ip0 + block_size);
+      Index ip = ip0;
       try {
-        get_stepwise_blackbody_radiation(
-            B, dB_dT, ppvar_f(joker, ip), ppvar_t[ip], temperature_jacobian);
-
-        get_stepwise_clearsky_propmat(l_ws,
-                                      K[ip],
-                                      S,
-                                      lte[ip],
-                                      dK_dx[ip],
-                                      dS_dx,
-                                      l_propmat_clearsky_agenda,
-                                      jacobian_quantities,
-                                      ppvar_f(joker, ip),
-                                      ppvar_mag(joker, ip),
-                                      ppath.los(ip, joker),
-                                      ppvar_nlte[ip],
-                                      ppvar_vmr(joker, ip),
-                                      ppvar_t[ip],
-                                      ppvar_p[ip],
-                                      jac_species_i,
-                                      j_analytical_do);
-
-        if (j_analytical_do)
-          adapt_stepwise_partial_derivatives(dK_dx[ip],
-                                             dS_dx,
-                                             jacobian_quantities,
-                                             ppvar_f(joker, ip),
-                                             ppath.los(ip, joker),
-                                             ppvar_vmr(joker, ip),
-                                             ppvar_t[ip],
-                                             ppvar_p[ip],
-                                             jac_species_i,
-                                             lte[ip],
-                                             atmosphere_dim,
-                                             j_analytical_do);
-
-        // Here absorption equals extinction
-        a = K[ip];
-        if (j_analytical_do)
-          FOR_ANALYTICAL_JACOBIANS_DO(da_dx[iq] = dK_dx[ip][iq];);
-
-        stepwise_source(src_rad[ip],
-                        dsrc_rad[ip],
-                        K[ip],
-                        a,
-                        S,
-                        dK_dx[ip],
-                        da_dx,
-                        dS_dx,
-                        B,
-                        dB_dT,
-                        jacobian_quantities,
-                        jacobian_do);
+        for (; ip < ip1; ip++) {
+          get_stepwise_blackbody_radiation(
+              B, dB_dT, ppvar_f(joker, ip), ppvar_t[ip], temperature_jacobian);
+
+          PropagationMatrix& K_ip = scalar_rt ? K_scl : K[ip];
+          get_stepwise_clearsky_propmat(l_ws,
+                                        K_ip,
+                                        S,
+                                        lte[ip],
+                                        dK_dx[ip],
+                                        dS_dx,
+                                        l_propmat_clearsky_agenda,
+                                        jacobian_quantities,
+                                        ppvar_f(joker, ip),
+                                        ppvar_mag(joker, ip),
+                                        ppath.los(ip, joker),
+                                        ppvar_nlte[ip],
+                                        ppvar_vmr(joker, ip),
+                                        ppvar_t[ip],
+                                        ppvar_p[ip],
+                                        jac_species_i,
+                                        j_analytical_do);
+
+          if (j_analytical_do)
+            adapt_stepwise_partial_derivatives(dK_dx[ip],
+                                               dS_dx,
+                                               jacobian_quantities,
+                                               ppvar_f(joker, ip),
+                                               ppath.los(ip, joker),
+                                               ppvar_vmr(joker, ip),
+                                               ppvar_t[ip],
+                                               ppvar_p[ip],
+                                               jac_species_i,
+                                               lte[ip],
+                                               atmosphere_dim,
+                                               j_analytical_do);
+
+          // Same as stepwise_source, with absorption equal to extinction
+          if (scalar_rt) {
+            scl_k(ip, joker) = K_ip.Kjj();
+            const ConstVectorView k = K_ip.Kjj();
+            if (S.IsEmpty()) {
+              for (Index iv = 0; iv < nf; iv++)
+                scl_src(ip, iv) = k[iv] == 0 ? 0 : k[iv] * B[iv] * (1 / k[iv]);
+            } else {
+              const ConstVectorView s_jj = S.Kjj();
+              for (Index iv = 0; iv < nf; iv++)
+                scl_src(ip, iv) =
+                    k[iv] == 0 ? 0 : (k[iv] * B[iv] + s_jj[iv]) * (1 / k[iv]);
+            }
+            if (ip > ip0) layer_transmission(ip);
+            continue;
+          }
+
+          // Here absorption equals extinction
+          a = K[ip];
+          if (j_analytical_do)
+            FOR_ANALYTICAL_JACOBIANS_DO(da_dx[iq] = dK_dx[ip][iq];);
+
+          stepwise_source(src_rad[ip],
+                          dsrc_rad[ip],
+                          K[ip],
+                          a,
+                          S,
+                          dK_dx[ip],
+                          da_dx,
+                          dS_dx,
+                          B,
+                          dB_dT,
+                          jacobian_quantities,
+                          jacobian_do);
+
+          if (ip > ip0) layer_transmission(ip);
+        }
       } catch (const std::runtime_error& e) {
         ostringstream os;
-        os << "Runtime-error in source calculation at index " << ip
-           << ": \n";
+        os << "Runtime-error in source or transmission calculation at index "
+           << ip << ": \n";
         os << e.what();
-#pragma omp critical(iyEmissionStandard_source)
-        {
-          do_abort = true;
-          fail_msg.push_back(os.str());
-        }
+        fail_msg[ib] = os.str();
       }
     }
 
-#pragma omp parallel for if (!arts_omp_in_parallel())
-    for (Index ip = 1; ip < np; ip++) {
-      if (do_abort) continue;
+    bool do_abort = false;
+    for (const auto& msg : fail_msg)
+      if (msg.nelem()) do_abort = true;
+
+    // The layers between the blocks
+    for (Index ib = 1; ib < nblocks and not do_abort; ib++) {
+      const Index ip = ib * block_size;
+      if (ip >= np) break;
       try {
-        const Numeric dr_dT_past =
-            do_hse ? ppath.lstep[ip - 1] / (2.0 * ppvar_t[ip - 1]) : 0;
-        const Numeric dr_dT_this =
-            do_hse ? ppath.lstep[ip - 1] / (2.0 * ppvar_t[ip]) : 0;
-        stepwise_transmission(lyr_tra[ip],
-                              dlyr_tra_above[ip],
-                              dlyr_tra_below[ip],
-                              K[ip - 1],
-                              K[ip],
-                              dK_dx[ip - 1],
-                              dK_dx[ip],
-                              ppath.lstep[ip - 1],
-                              dr_dT_past,
-                              dr_dT_this,
-                              temperature_derivative_position);
-        
-        r[ip - 1] = ppath.lstep[ip - 1];
-        if (temperature_derivative_position >= 0){
-          dr_below[ip][temperature_derivative_position] = dr_dT_past;
-          dr_above[ip][temperature_derivative_position] = dr_dT_this;
-        }
+        layer_transmission(ip);
       } catch (const std::runtime_error& e) {
         ostringstream os;
         os << "Runtime-error in transmission calculation at index " << ip
            << ": \n";
         os << e.what();
-#pragma omp critical(iyEmissionStandard_transmission)
-        {
-          do_abort = true;
-          fail_msg.push_back(os.str());
-        }
+        fail_msg[ib] = os.str();
+        do_abort = true;
       }
     }
 
@@ -473,26 +532,36 @@ void iyEmissionStandard(
       std::ostringstream os;
       os << "Error messages from failed cases:\n";
       for (const auto& msg : fail_msg) {
-        os << msg << '\n';
+        if (msg.nelem()) os << msg << '\n';
       }
       throw std::runtime_error(os.str());
     }
   }
 
-  const ArrayOfTransmissionMatrix tot_tra =
-      cumulative_transmission(lyr_tra, CumulativeTransmission::Forward);
+  ArrayOfTransmissionMatrix tot_tra;
+  Matrix scl_tot;
+  Tensor3 tot_tra_last;
+  if (scalar_rt) {
+    scalar_cumulative_transmission(scl_tot, scl_tra);
+    tot_tra_last.resize(nf, 1, 1);
+    tot_tra_last(joker, 0, 0) = scl_tot(np - 1, joker);
+  } else {
+    tot_tra =
+        cumulative_transmission(lyr_tra, CumulativeTransmission::Forward);
+    tot_tra_last = tot_tra[np - 1];
+  }
 
   // iy_transmittance
   Tensor3 iy_trans_new;
   if (iy_agenda_call1)
-    iy_trans_new = tot_tra[np - 1];
+    iy_trans_new = tot_tra_last;
   else
-    iy_transmittance_mult(iy_trans_new, iy_transmittance, tot_tra[np - 1]);
+    iy_transmittance_mult(iy_trans_new, iy_transmittance, tot_tra_last);
 
   // iy_aux: Optical depth
   if (auxOptDepth >= 0)
     for (Index iv = 0; iv < nf; iv++)
-      iy_aux[auxOptDepth](iv, 0) = -std::log(tot_tra[np - 1](iv, 0, 0));
+      iy_aux[auxOptDepth](iv, 0) = -std::log(tot_tra_last(iv, 0, 0));
 
   // Radiative background
   get_iy_of_background(ws,
@@ -518,73 +587,85 @@ void iyEmissionStandard(
                        iy_agenda_call1,
                        verbosity);
 
-  lvl_rad[np - 1] = iy;
-
-  // Radiative transfer calculations
-  if (rt_integration_option == "first order" || rt_integration_option == "default") {
-    for (Index ip = np - 2; ip >= 0; ip--) {
-      lvl_rad[ip] = lvl_rad[ip + 1];
-      update_radiation_vector(lvl_rad[ip],
-                              dlvl_rad[ip],
-                              dlvl_rad[ip + 1],
-                              src_rad[ip],
-                              src_rad[ip + 1],
-                              dsrc_rad[ip],
-                              dsrc_rad[ip + 1],
-                              lyr_tra[ip + 1],
-                              tot_tra[ip],
-                              dlyr_tra_above[ip + 1],
-                              dlyr_tra_below[ip + 1],
-                              PropagationMatrix(),
-                              PropagationMatrix(),
-                              ArrayOfPropagationMatrix(),
-                              ArrayOfPropagationMatrix(),
-                              Numeric(),
-                              Vector(),
-                              Vector(),
-                              0,
-                              0,
-                              RadiativeTransferSolver::Emission);
-    }
-  } else if (rt_integration_option == "second order") {
-    for (Index ip = np - 2; ip >= 0; ip--) {
-      lvl_rad[ip] = lvl_rad[ip + 1];
-      update_radiation_vector(lvl_rad[ip],
-                              dlvl_rad[ip],
-                              dlvl_rad[ip + 1],
-                              src_rad[ip],
-                              src_rad[ip + 1],
-                              dsrc_rad[ip],
-                              dsrc_rad[ip + 1],
-                              lyr_tra[ip + 1],
-                              tot_tra[ip],
-                              dlyr_tra_above[ip + 1],
-                              dlyr_tra_below[ip + 1],
-                              K[ip],
-                              K[ip + 1],
-                              dK_dx[ip + 1],
-                              dK_dx[ip + 1],
-                              r[ip],
-                              dr_above[ip + 1],
-                              dr_below[ip + 1],
-                              0,
-                              0,
-                              RadiativeTransferSolver::LinearWeightedEmission);
-    }
+  if (scalar_rt) {
+    // Radiative transfer calculations, as update_radiation_vector
+    Matrix scl_iy;
+    scalar_radiative_transfer(scl_iy, iy(joker, 0), scl_tra, scl_src);
+
+    // Copy back to ARTS external style
+    iy(joker, 0) = scl_iy(0, joker);
+    ppvar_trans_cumulat(joker, joker, 0, 0) = scl_tot;
+    ppvar_trans_partial(joker, joker, 0, 0) = scl_tra;
+    ppvar_iy(joker, 0, joker) = transpose(scl_iy);
   } else {
-    throw runtime_error("Only allowed choices for *integration order* are "
-                        "1 and 2.");    
-  }
+    lvl_rad[np - 1] = iy;
+
+    // Radiative transfer calculations
+    if (rt_integration_option == "first order" || rt_integration_option == "default") {
+      for (Index ip = np - 2; ip >= 0; ip--) {
+        lvl_rad[ip] = lvl_rad[ip + 1];
+        update_radiation_vector(lvl_rad[ip],
+                                dlvl_rad[ip],
+                                dlvl_rad[ip + 1],
+                                src_rad[ip],
+                                src_rad[ip + 1],
+                                dsrc_rad[ip],
+                                dsrc_rad[ip + 1],
+                                lyr_tra[ip + 1],
+                                tot_tra[ip],
+                                dlyr_tra_above[ip + 1],
+                                dlyr_tra_below[ip + 1],
+                                PropagationMatrix(),
+                                PropagationMatrix(),
+                                ArrayOfPropagationMatrix(),
+                                ArrayOfPropagationMatrix(),
+                                Numeric(),
+                                Vector(),
+                                Vector(),
+                                0,
+                                0,
+                                RadiativeTransferSolver::Emission);
+      }
+    } else if (rt_integration_option == "second order") {
+      for (Index ip = np - 2; ip >= 0; ip--) {
+        lvl_rad[ip] = lvl_rad[ip + 1];
+        update_radiation_vector(lvl_rad[ip],
+                                dlvl_rad[ip],
+                                dlvl_rad[ip + 1],
+                                src_rad[ip],
+                                src_rad[ip + 1],
+                                dsrc_rad[ip],
+                                dsrc_rad[ip + 1],
+                                lyr_tra[ip + 1],
+                                tot_tra[ip],
+                                dlyr_tra_above[ip + 1],
+                                dlyr_tra_below[ip + 1],
+                                K[ip],
+                                K[ip + 1],
+                                dK_dx[ip + 1],
+                                dK_dx[ip + 1],
+                                r[ip],
+                                dr_above[ip + 1],
+                                dr_below[ip + 1],
+                                0,
+                                0,
+                                RadiativeTransferSolver::LinearWeightedEmission);
+      }
+    } else {
+      throw runtime_error("Only allowed choices for *integration order* are "
+                          "1 and 2.");    
+    }
   
-  // Copy back to ARTS external style
-  iy = lvl_rad[0];
-  for (Index ip = 0; ip < lvl_rad.nelem(); ip++) {
-    ppvar_trans_cumulat(ip, joker, joker, joker) = tot_tra[ip];
-    ppvar_trans_partial(ip, joker, joker, joker) = lyr_tra[ip];
-    ppvar_iy(joker, joker, ip) = lvl_rad[ip];
-    if (j_analytical_do)
-      FOR_ANALYTICAL_JACOBIANS_DO(diy_dpath[iq](ip, joker, joker) =
-                                      dlvl_rad[ip][iq];);
+    // Copy back to ARTS external style
+    iy = lvl_rad[0];
+    for (Index ip = 0; ip < lvl_rad.nelem(); ip++) {
+      ppvar_trans_cumulat(ip, joker, joker, joker) = tot_tra[ip];
+      ppvar_trans_partial(ip, joker, joker, joker) = lyr_tra[ip];
+      ppvar_iy(joker, joker, ip) = lvl_rad[ip];
+      if (j_analytical_do)
+        FOR_ANALYTICAL_JACOBIANS_DO(diy_dpath[iq](ip, joker, joker) =
+                                        dlvl_rad[ip][iq];);
+    }
   }
 
   // Finalize analytical Jacobians
@@ -1304,6 +1385,7 @@ void iyMC(Workspace& ws,
                   mc_taustep_limit,
                   1,
                   t_interp_order,
+                  0,
                   verbosity);
 
         assert(y.nelem() == stokes_dim);
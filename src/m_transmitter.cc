@@ -786,15 +786,23 @@ void iyTransmissionStandard(Workspace& ws,
   //
   ppvar_trans_cumulat.resize(np, nf, ns, ns);
 
-  ArrayOfRadiationVector lvl_rad(np, RadiationVector(nf, ns));
+  // Unpolarised transmission without analytical Jacobians is computed by a
+  // scalar engine, holding the layer transmissions as a plain (np, nf)
+  // matrix instead of the general polarised types below
+  const bool scalar_rt = ns == 1 and not j_analytical_do;
+  const Index npg = scalar_rt ? 0 : np;
+
+  Matrix scl_tra(scalar_rt ? np : 0, nf, 1);
+
+  ArrayOfRadiationVector lvl_rad(npg, RadiationVector(nf, ns));
   ArrayOfArrayOfRadiationVector dlvl_rad(
-      np, ArrayOfRadiationVector(nq, RadiationVector(nf, ns)));
+      npg, ArrayOfRadiationVector(nq, RadiationVector(nf, ns)));
 
-  ArrayOfTransmissionMatrix lyr_tra(np, TransmissionMatrix(nf, ns));
+  ArrayOfTransmissionMatrix lyr_tra(npg, TransmissionMatrix(nf, ns));
   ArrayOfArrayOfTransmissionMatrix dlyr_tra_above(
-      np, ArrayOfTransmissionMatrix(nq, TransmissionMatrix(nf, ns)));
+      npg, ArrayOfTransmissionMatrix(nq, TransmissionMatrix(nf, ns)));
   ArrayOfArrayOfTransmissionMatrix dlyr_tra_below(
-      np, ArrayOfTransmissionMatrix(nq, TransmissionMatrix(nf, ns)));
+      npg, ArrayOfTransmissionMatrix(nq, TransmissionMatrix(nf, ns)));
 
   ArrayOfIndex clear2cloudy;
   //
@@ -936,8 +944,13 @@ void iyTransmissionStandard(Workspace& ws,
         }
       }
 
-      // Transmission
-      if (ip not_eq 0) {
+      // Transmission, as stepwise_transmission
+      if (ip not_eq 0 and scalar_rt) {
+        scalar_stepwise_transmission(scl_tra(ip, joker),
+                                     K_past.Kjj(),
+                                     K_this.Kjj(),
+                                     ppath.lstep[ip - 1]);
+      } else if (ip not_eq 0) {
         const Numeric dr_dT_past =
             do_hse ? ppath.lstep[ip - 1] / (2.0 * ppvar_t[ip - 1]) : 0;
         const Numeric dr_dT_this =
@@ -960,51 +973,70 @@ void iyTransmissionStandard(Workspace& ws,
     }
   }
 
-  const ArrayOfTransmissionMatrix tot_tra =
-      cumulative_transmission(lyr_tra, CumulativeTransmission::Forward);
+  ArrayOfTransmissionMatrix tot_tra;
+  Matrix scl_tot;
+  if (scalar_rt)
+    scalar_cumulative_transmission(scl_tot, scl_tra);
+  else
+    tot_tra = cumulative_transmission(lyr_tra, CumulativeTransmission::Forward);
 
   // iy_aux: Optical depth
   if (auxOptDepth >= 0) {
     for (Index iv = 0; iv < nf; iv++)
-      iy_aux[auxOptDepth](iv, 0) = -std::log(tot_tra[np - 1](iv, 0, 0));
+      iy_aux[auxOptDepth](iv, 0) = -std::log(
+          scalar_rt ? scl_tot(np - 1, iv) : tot_tra[np - 1](iv, 0, 0));
   }
 
-  lvl_rad[np - 1] = iy;
-
-  // Radiative transfer calculations
-  for (Index ip = np - 2; ip >= 0; ip--) {
-    lvl_rad[ip] = lvl_rad[ip + 1];
-    update_radiation_vector(lvl_rad[ip],
-                            dlvl_rad[ip],
-                            dlvl_rad[ip + 1],
-                            RadiationVector(),
-                            RadiationVector(),
-                            ArrayOfRadiationVector(),
-                            ArrayOfRadiationVector(),
-                            lyr_tra[ip + 1],
-                            tot_tra[ip],
-                            dlyr_tra_above[ip + 1],
-                            dlyr_tra_below[ip + 1],
-                            PropagationMatrix(),
-                            PropagationMatrix(),
-                            ArrayOfPropagationMatrix(),
-                            ArrayOfPropagationMatrix(),
-                            Numeric(),
-                            Vector(),
-                            Vector(),
-                            0,
-                            0,
-                            RadiativeTransferSolver::Transmission);
-  }
+  // ppvar_iy is empty if ppath is totally outside the atmosphere
+  const bool do_ppvar_iy = ppvar_iy.ncols() == np;
+
+  if (scalar_rt) {
+    // Radiative transfer calculations
+    Matrix scl_iy;
+    scalar_radiative_transfer(scl_iy, iy(joker, 0), scl_tra, Matrix());
 
-  // Copy back to ARTS external style
-  iy = lvl_rad[0];
-  for (Index ip = 0; ip < lvl_rad.nelem(); ip++) {
-    ppvar_trans_cumulat(ip, joker, joker, joker) = tot_tra[ip];
-    ppvar_iy(joker, joker, ip) = lvl_rad[ip];
-    if (j_analytical_do)
-      FOR_ANALYTICAL_JACOBIANS_DO(diy_dpath[iq](ip, joker, joker) =
-                                      dlvl_rad[ip][iq];);
+    // Copy back to ARTS external style
+    iy(joker, 0) = scl_iy(0, joker);
+    ppvar_trans_cumulat(joker, joker, 0, 0) = scl_tot;
+    if (do_ppvar_iy) ppvar_iy(joker, 0, joker) = transpose(scl_iy);
+  } else {
+    lvl_rad[np - 1] = iy;
+
+    // Radiative transfer calculations
+    for (Index ip = np - 2; ip >= 0; ip--) {
+      lvl_rad[ip] = lvl_rad[ip + 1];
+      update_radiation_vector(lvl_rad[ip],
+                              dlvl_rad[ip],
+                              dlvl_rad[ip + 1],
+                              RadiationVector(),
+                              RadiationVector(),
+                              ArrayOfRadiationVector(),
+                              ArrayOfRadiationVector(),
+                              lyr_tra[ip + 1],
+                              tot_tra[ip],
+                              dlyr_tra_above[ip + 1],
+                              dlyr_tra_below[ip + 1],
+                              PropagationMatrix(),
+                              PropagationMatrix(),
+                              ArrayOfPropagationMatrix(),
+                              ArrayOfPropagationMatrix(),
+                              Numeric(),
+                              Vector(),
+                              Vector(),
+                              0,
+                              0,
+                              RadiativeTransferSolver::Transmission);
+    }
+
+    // Copy back to ARTS external style
+    iy = lvl_rad[0];
+    for (Index ip = 0; ip < lvl_rad.nelem(); ip++) {
+      ppvar_trans_cumulat(ip, joker, joker, joker) = tot_tra[ip];
+      if (do_ppvar_iy) ppvar_iy(joker, joker, ip) = lvl_rad[ip];
+      if (j_analytical_do)
+        FOR_ANALYTICAL_JACOBIANS_DO(diy_dpath[iq](ip, joker, joker) =
+                                        dlvl_rad[ip][iq];);
+    }
   }
 
   // Finalize analytical Jacobians
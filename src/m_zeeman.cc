@@ -56,6 +56,7 @@ void propmat_clearskyAddZeeman(
     const Numeric& manual_zeeman_magnetic_field_strength,
     const Numeric& manual_zeeman_theta,
     const Numeric& manual_zeeman_eta,
+    const String& faddeeva_accuracy,
     const Verbosity&) try {
   if (abs_lines_per_species.nelem() == 0) return;
 
@@ -93,7 +94,8 @@ void propmat_clearskyAddZeeman(
                     manual_zeeman_tag,
                     manual_zeeman_magnetic_field_strength,
                     manual_zeeman_theta,
-                    manual_zeeman_eta);
+                    manual_zeeman_eta,
+                    FaddeevaBlock::string2accuracy(faddeeva_accuracy));
 } catch (const char* e) {
   std::ostringstream os;
   os << "Errors raised by *propmat_clearskyAddZeeman*:\n";
@@ -41,6 +41,7 @@
 #include <map>
 
 #include "absorption.h"
+#include "agenda_profiler.h"
 #include "agenda_record.h"
 #include "arts_omp.h"
 #include "auto_md.h"
@@ -1014,6 +1015,8 @@ int main(int argc, char** argv) {
          << "                    Report file: "
          << verbosity.get_file_verbosity() << "\n";
 
+    if (parameters.profile.nelem()) AgendaProfiler::enable();
+
     out3 << "\nReading control files:\n";
     for (Index i = 0; i < parameters.controlfiles.nelem(); ++i) {
       try {
@@ -1048,6 +1051,14 @@ int main(int argc, char** argv) {
         throw runtime_error(os.str());
       }
     }
+
+    if (parameters.profile.nelem()) {
+      ostringstream os;
+      AgendaProfiler::print_table(os);
+      out1 << os.str() << "\n";
+      AgendaProfiler::write_folded(parameters.profile);
+      out1 << "Agenda profile written to " << parameters.profile << "\n";
+    }
   } catch (const std::runtime_error& x) {
 #ifdef TIME_SUPPORT
     struct tms arts_cputime_end;
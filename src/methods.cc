@@ -1938,6 +1938,16 @@ void define_md_data_raw() {
           "Of course, the method also performs quite a lot of checks on the\n"
           "table. If something is not ok, a runtime error is thrown.\n"
           "\n"
+          "With *view* set to 1, the cross sections are not cut down. The\n"
+          "adapted table then shares all cross sections of the original table,\n"
+          "and only keeps which of them belong to the current species and\n"
+          "frequencies. Adapting even a very large table then takes no extra\n"
+          "memory. Copies of the original table, and tables that are adapted\n"
+          "from them, share the same cross sections, as long as these are\n"
+          "memory mapped (see *abs_lookupReadMapped*), packed (see\n"
+          "*abs_lookupSetStorage*), or the table was adapted in view mode\n"
+          "before it was copied.\n"
+          "\n"
           "The method sets a flag *abs_lookup_is_adapted* to indicate that the\n"
           "table has been checked and that it is ok. Never set this by hand,\n"
           "always use this method to set it!\n"),
@@ -1947,10 +1957,11 @@ void define_md_data_raw() {
       GOUT_TYPE(),
       GOUT_DESC(),
       IN("abs_lookup", "abs_species", "f_grid"),
-      GIN(),
-      GIN_TYPE(),
-      GIN_DEFAULT(),
-      GIN_DESC()));
+      GIN("view"),
+      GIN_TYPE("Index"),
+      GIN_DEFAULT("0"),
+      GIN_DESC("Flag to keep the cross sections and only store which of them "
+               "are used, 0 or 1.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_lookupCalc"),
@@ -1968,7 +1979,19 @@ void define_md_data_raw() {
           "generated.\n"
           "\n"
           "Note, that the absorbing gas can be any gas, but the perturbing gas is\n"
-          "always H2O.\n"),
+          "always H2O.\n"
+          "\n"
+          "The table is computed in tiles of one species, one H2O VMR perturbation,\n"
+          "and one temperature perturbation, and the tiles are computed in\n"
+          "parallel. If *checkpoint_basename* is given, every finished tile is\n"
+          "written to its own file starting with that name. A killed job that\n"
+          "is restarted with the same *checkpoint_basename* takes the finished\n"
+          "tiles from these files and only computes the rest. The files keep\n"
+          "their frequency and pressure grids, so extending *f_grid* or *abs_p*\n"
+          "only computes the new frequencies and pressures. Each file also keeps\n"
+          "a fingerprint of *abs_species*, *abs_nls*, *abs_t*, *abs_vmrs* and\n"
+          "*abs_lines_per_species*, and files with another fingerprint are not\n"
+          "reused, so the tile is computed again.\n"),
       AUTHORS("Stefan Buehler"),
       OUT("abs_lookup", "abs_lookup_is_adapted"),
       GOUT(),
@@ -1982,11 +2005,12 @@ void define_md_data_raw() {
          "abs_t",
          "abs_t_pert",
          "abs_nls_pert",
+         "abs_lines_per_species",
          "abs_xsec_agenda"),
-      GIN(),
-      GIN_TYPE(),
-      GIN_DEFAULT(),
-      GIN_DESC()));
+      GIN("checkpoint_basename"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(""),
+      GIN_DESC("Basename of the checkpoint files of the tiles, empty for none.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_lookupInit"),
@@ -2006,6 +2030,63 @@ void define_md_data_raw() {
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("abs_lookupReadMapped"),
+      DESCRIPTION(
+          "Reads a gas absorption lookup table written by *abs_lookupWriteMapped*.\n"
+          "\n"
+          "The grids and the other metadata are read from the XML file\n"
+          "*filename*, while the cross sections are memory mapped from the\n"
+          "raw .xsec file next to it. The XML file is searched for as all XML\n"
+          "files, so that *filename* can leave out the .xml extension and can\n"
+          "be in the include path. No cross sections are read up front, the\n"
+          "operating system loads the pages that the interpolation touches on\n"
+          "demand and shares them between processes that map the same file.\n"
+          "\n"
+          "The mapping is kept by *abs_lookupAdapt* when the adaption does not\n"
+          "change the table, so that adapting a table for the species and\n"
+          "frequencies it was made for costs no copy.\n"),
+      AUTHORS("agent"),
+      OUT("abs_lookup"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN(),
+      GIN("filename"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Name of the XML file of the table.")));
+
+  md_data_raw.push_back(create_mdrecord(
+      NAME("abs_lookupSetStorage"),
+      DESCRIPTION(
+          "Changes the storage type of the cross sections of the lookup table.\n"
+          "\n"
+          "\"Double\" keeps the cross sections as they are calculated.\n"
+          "\"Float\" stores them in single precision, which halves the memory\n"
+          "with a relative error of 6e-8. \"Quantized\" stores the logarithm of\n"
+          "each cross section as a 16 bit code, with an offset and a step for\n"
+          "each pressure profile of each frequency. This takes a bit more than\n"
+          "a quarter of the memory. The error depends on the range of the\n"
+          "values in each profile, and is reported with verbosity level 2.\n"
+          "\n"
+          "Float and Quantized tables keep this storage in\n"
+          "*abs_lookupAdapt* and *abs_lookupWriteMapped*, so that both the\n"
+          "memory and the file size are reduced. *WriteXML* and *WriteNetCDF*\n"
+          "always write doubles.\n"
+          "\n"
+          "*abs_lookupTestAccuracy* reports the error of the storage.\n"),
+      AUTHORS("agent"),
+      OUT("abs_lookup"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("abs_lookup"),
+      GIN("storage"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Storage type, \"Double\", \"Float\" or \"Quantized\".")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_lookupSetup"),
       DESCRIPTION(
@@ -2212,6 +2293,11 @@ void define_md_data_raw() {
           "calculations for strategically selected conditions (in-between the\n"
           "lookup table grid points).\n"
           "\n"
+          "For tables that are not stored as \"Double\", see\n"
+          "*abs_lookupSetStorage*, the error at the grid points is reported\n"
+          "as well. There is no interpolation there, so this is the error of\n"
+          "the storage.\n"
+          "\n"
           "For error units see *abs_lookupTestAccMC*\n"
           "\n"
           "Produces no workspace output, only output to the output streams.\n"),
@@ -2263,6 +2349,29 @@ void define_md_data_raw() {
       GIN_DEFAULT(),
       GIN_DESC()));
   
+  md_data_raw.push_back(create_mdrecord(
+      NAME("abs_lookupWriteMapped"),
+      DESCRIPTION(
+          "Writes a gas absorption lookup table for *abs_lookupReadMapped*.\n"
+          "\n"
+          "The grids and the other metadata are written as a binary XML file\n"
+          "to *filename*, so that they are exact. The cross sections are\n"
+          "written in their storage type, see *abs_lookupSetStorage*, and in\n"
+          "native byte order to the raw file *filename*.xsec, which must not\n"
+          "be moved away from the XML file. The raw file has a small header with the dimensions\n"
+          "of the data and is only readable on machines with the same byte\n"
+          "order.\n"),
+      AUTHORS("agent"),
+      OUT(),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("abs_lookup"),
+      GIN("filename"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Name of the XML file of the table.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_nlteFromRaw"),
       DESCRIPTION("Sets NLTE values manually\n"
@@ -2612,7 +2721,17 @@ void define_md_data_raw() {
       NAME("abs_xsec_per_speciesAddLines"),
       DESCRIPTION(
           "Calculates the line spectrum for both attenuation and phase\n"
-          "for each tag group and adds it to abs_xsec_per_species.\n"),
+          "for each tag group and adds it to abs_xsec_per_species.\n"
+          "\n"
+          "A positive *line_window_threshold* turns on adaptive line windows\n"
+          "for bands without cutoff.  Each line is then only evaluated where\n"
+          "its Doppler and pressure broadened shape is above this fraction of\n"
+          "its peak.  Outside of the window, the line is continued from the\n"
+          "window edge as a Lorentz far wing, up to where the wing has fallen\n"
+          "to the threshold of its edge value.  The far wing is not added to\n"
+          "the partial derivatives.  This is much faster for wide *f_grid*\n"
+          "with many lines, at the cost of accuracy in the far wings.\n"
+          "Values around 1e-6 are a reasonable start.\n"),
       AUTHORS("Richard Larsson"),
       OUT("abs_xsec_per_species",
           "src_xsec_per_species",
@@ -2637,10 +2756,13 @@ void define_md_data_raw() {
          "isotopologue_ratios",
          "partition_functions",
          "lbl_checked"),
-      GIN(),
-      GIN_TYPE(),
-      GIN_DEFAULT(),
-      GIN_DESC()));
+      GIN("faddeeva_accuracy", "line_window_threshold"),
+      GIN_TYPE("String", "Numeric"),
+      GIN_DEFAULT("Exact", "0"),
+      GIN_DESC("Accuracy of the Faddeeva function in Voigt and HTP line shapes."
+               " \"Exact\", \"High\" (relative error ~1e-12), or"
+               " \"Fast\" (relative error ~1e-6)",
+               "Relative threshold of the adaptive line windows, 0 for none")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_xsec_per_speciesAddPredefinedO2MPM2020"),
@@ -4433,7 +4555,18 @@ void define_md_data_raw() {
           "Note: The atmospheric dimensionality *atmosphere_dim* can be\n"
           "      either 1 or 3. To these dimensions the method adapts\n"
           "      automatically. 2D scattering calculations are not\n"
-          "      supported.\n"),
+          "      supported.\n"
+          "\n"
+          "The iteration can be accelerated by setting *accelerated* to the\n"
+          "number of Stokes components to accelerate. With the default\n"
+          "\"NG\" method, every fourth iteration step is extrapolated from the\n"
+          "previous ones (1D only). With \"Anderson\", every iteration step\n"
+          "is replaced by the combination of the last *acceleration_memory*\n"
+          "steps that minimizes the change of the field in a least-squares\n"
+          "sense. This is equivalent to GMRES for a long memory. When the\n"
+          "iteration converges slowly, as for optically thick clouds, it needs\n"
+          "somewhat fewer iterations than NG with the default memory, and\n"
+          "considerably fewer with a longer one.\n"),
       AUTHORS("Claudia Emde, Jakob Doerr"),
       OUT("cloudbox_field_mono"),
       GOUT(),
@@ -4443,11 +4576,13 @@ void define_md_data_raw() {
          "doit_scat_field_agenda",
          "doit_rte_agenda",
          "doit_conv_test_agenda"),
-      GIN("accelerated"),
-      GIN_TYPE("Index"),
-      GIN_DEFAULT("0"),
+      GIN("accelerated", "acceleration_method", "acceleration_memory"),
+      GIN_TYPE("Index", "String", "Index"),
+      GIN_DEFAULT("0", "NG", "5"),
       GIN_DESC(
-          "Index wether to accelerate only the intensity (1) or the whole Stokes Vector (4)")));
+          "Index wether to accelerate only the intensity (1) or the whole Stokes Vector (4)",
+          "Acceleration method, \"NG\" or \"Anderson\".",
+          "Number of previous iteration steps combined by Anderson acceleration.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("cloudbox_fieldCrop"),
@@ -5567,16 +5702,19 @@ void define_md_data_raw() {
          "z_surface",
          "surface_skin_t",
          "surface_scalar_reflectivity"),
-      GIN("nstreams", "pfct_method", "Npfct", "quiet"),
-      GIN_TYPE("Index", "String", "Index", "Index"),
-      GIN_DEFAULT("8", "median", "181", "0"),
+      GIN("nstreams", "pfct_method", "Npfct", "quiet", "f_chunk_size"),
+      GIN_TYPE("Index", "String", "Index", "Index", "Index"),
+      GIN_DEFAULT("8", "median", "181", "0", "0"),
       GIN_DESC("Number of polar angle directions (streams) in DISORT "
                "solution (must be an even number).",
                "Flag which method to apply to derive phase function.",
                "Number of angular grid points to calculate bulk phase"
                " function on (and derive Legendre polnomials from). If <0,"
                " the finest za_grid from scat_data will be used.",
-               "Silence C Disort warnings.")));
+               "Silence C Disort warnings.",
+               "Number of consecutive frequencies handed to a thread at a"
+               " time. If 0 or below, each thread gets one contiguous part"
+               " of *f_grid*.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("DisortCalcWithARTSSurface"),
@@ -5606,16 +5744,19 @@ void define_md_data_raw() {
          "f_grid",
          "za_grid",
          "stokes_dim"),
-      GIN("nstreams", "pfct_method", "Npfct", "quiet"),
-      GIN_TYPE("Index", "String", "Index", "Index"),
-      GIN_DEFAULT("8", "median", "181", "0"),
+      GIN("nstreams", "pfct_method", "Npfct", "quiet", "f_chunk_size"),
+      GIN_TYPE("Index", "String", "Index", "Index", "Index"),
+      GIN_DEFAULT("8", "median", "181", "0", "0"),
       GIN_DESC("Number of polar angle directions (streams) in DISORT "
                "solution (must be an even number).",
                "Flag which method to apply to derive phase function.",
                "Number of angular grid points to calculate bulk phase"
                " function on (and derive Legendre polnomials from). If <0,"
                " the finest za_grid from scat_data will be used.",
-               "Silence C Disort warnings.")));
+               "Silence C Disort warnings.",
+               "Number of consecutive frequencies handed to a thread at a"
+               " time. If 0 or below, each thread gets one contiguous part"
+               " of *f_grid*.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("DisortCalcClearsky"),
@@ -5646,12 +5787,15 @@ void define_md_data_raw() {
          "z_surface",
          "surface_skin_t",
          "surface_scalar_reflectivity"),
-      GIN("nstreams", "quiet"),
-      GIN_TYPE("Index", "Index"),
-      GIN_DEFAULT("8", "0"),
+      GIN("nstreams", "quiet", "f_chunk_size"),
+      GIN_TYPE("Index", "Index", "Index"),
+      GIN_DEFAULT("8", "0", "0"),
       GIN_DESC("Number of polar angle directions (streams) in DISORT "
                "solution (must be an even number).",
-               "Silence C Disort warnings.")));
+               "Silence C Disort warnings.",
+               "Number of consecutive frequencies handed to a thread at a"
+               " time. If 0 or below, each thread gets one contiguous part"
+               " of *f_grid*.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("DOBatchCalc"),
@@ -5685,7 +5829,11 @@ void define_md_data_raw() {
           "and *ybatch_n* must be set before calling this method.\n"
           "\n"
           "The input variable *ybatch_start* is set to a default of zero in\n"
-          "*general.arts*.\n"),
+          "*general.arts*.\n"
+          "\n"
+          "DISORT calculations of the jobs share one phase function cache per\n"
+          "thread, so the Legendre expansion of the phase functions is only\n"
+          "derived again when the scattering data or the angles change.\n"),
       AUTHORS("Oliver Lemke"),
       OUT("dobatch_cloudbox_field",
           "dobatch_radiance_field",
@@ -5750,7 +5898,18 @@ void define_md_data_raw() {
           "\n"
           "This method executes *doit_mono_agenda* for each frequency\n"
           "in *f_grid*. The output is the radiation field inside the cloudbox\n"
-          "(*cloudbox_field*).\n"),
+          "(*cloudbox_field*).\n"
+          "\n"
+          "Neighbouring frequencies often have almost the same converged\n"
+          "field. If *warm_start_chunk* is positive, *f_grid* is divided into\n"
+          "chunks of this many consecutive frequencies. The chunks are shared\n"
+          "among the threads and each chunk is handled in increasing\n"
+          "frequency order. Each frequency after the first of a chunk then\n"
+          "starts from the converged field of the previous frequency, shifted\n"
+          "by the difference of the first guesses in *cloudbox_field* of the\n"
+          "two frequencies. This typically reduces the number of iterations\n"
+          "for densely sampled channels. Fewer chunks than threads leaves\n"
+          "threads idle.\n"),
       AUTHORS("Claudia Emde"),
       OUT("cloudbox_field"),
       GOUT(),
@@ -5765,10 +5924,11 @@ void define_md_data_raw() {
          "f_grid",
          "doit_mono_agenda",
          "doit_is_initialized"),
-      GIN(),
-      GIN_TYPE(),
-      GIN_DEFAULT(),
-      GIN_DESC()));
+      GIN("warm_start_chunk"),
+      GIN_TYPE("Index"),
+      GIN_DEFAULT("0"),
+      GIN_DESC("Number of consecutive frequencies in a warm start chunk, "
+               "0 disables the warm start.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("DoitGetIncoming"),
@@ -10425,7 +10585,20 @@ void define_md_data_raw() {
           "\n"
           "Only \"1\" and \"RJBT\" are allowed for *iy_unit*. The value of\n"
           "*mc_error* follows the selection for *iy_unit* (both for in- and\n"
-          "output.\n"),
+          "output.\n"
+          "\n"
+          "By default all photons are traced one after the other, with one\n"
+          "random number generator seeded by *mc_seed*. If *stream_length*\n"
+          "is positive, the photons are instead traced in parallel. They are\n"
+          "then divided into streams of *stream_length* photons, and stream\n"
+          "number s (counting from 0) uses an own random number generator\n"
+          "seeded with *mc_seed* + s. The streams are shared among the\n"
+          "threads, and the sums of the streams are added up in stream order.\n"
+          "A run that ends through *mc_max_iter* traces the same photons, and\n"
+          "gives exactly the same result whatever the number of threads is.\n"
+          "The *mc_std_err* and\n"
+          "*mc_max_time* criteria are checked after every photon, but a few\n"
+          "more photons can be added by other threads before they stop.\n"),
       AUTHORS("Cory Davis"),
       OUT("y",
           "mc_iteration_count",
@@ -10472,15 +10645,17 @@ void define_md_data_raw() {
          "mc_max_iter",
          "mc_min_iter",
          "mc_taustep_limit"),
-      GIN("l_mc_scat_order", "t_interp_order"),
-      GIN_TYPE("Index", "Index"),
-      GIN_DEFAULT("11", "1"),
+      GIN("l_mc_scat_order", "t_interp_order", "stream_length"),
+      GIN_TYPE("Index", "Index", "Index"),
+      GIN_DEFAULT("11", "1", "0"),
       GIN_DESC("The length to be given to *mc_scat_order*. Note that"
                " scattering orders equal and above this value will not"
                " be counted.",
                "Interpolation order of temperature for scattering data (so"
                " far only applied in phase matrix, not in extinction and"
-               " absorption.")));
+               " absorption.",
+               "Number of photons per random number stream. A value of 0"
+               " or below traces all photons in sequence.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("MCRadar"),
@@ -10511,7 +10686,13 @@ void define_md_data_raw() {
           "\n"
           "Only \"1\" and \"Ze\" are allowed for *iy_unit*. The value of\n"
           "*mc_error* follows the selection for *iy_unit* (both for in- and\n"
-          "output.\n"),
+          "output.\n"
+          "\n"
+          "If *stream_length* is positive, the photons are traced in\n"
+          "parallel, in streams of *stream_length* photons. Stream number s\n"
+          "(counting from 0) uses an own random number generator seeded with\n"
+          "*mc_seed* + s. The sums of the streams are added up in stream\n"
+          "order, so the result does not depend on the number of threads.\n"),
       AUTHORS("Ian S. Adams"),
       OUT("y", "mc_error"),
       GOUT(),
@@ -10550,14 +10731,16 @@ void define_md_data_raw() {
          "mc_max_scatorder",
          "mc_seed",
          "mc_max_iter"),
-      GIN("ze_tref", "k2", "t_interp_order"),
-      GIN_TYPE("Numeric", "Numeric", "Index"),
-      GIN_DEFAULT("273.15", "-1", "1"),
+      GIN("ze_tref", "k2", "t_interp_order", "stream_length"),
+      GIN_TYPE("Numeric", "Numeric", "Index", "Index"),
+      GIN_DEFAULT("273.15", "-1", "1", "0"),
       GIN_DESC("Reference temperature for conversion to Ze.",
                "Reference dielectric factor.",
                "Interpolation order of temperature for scattering data (so"
                " far only applied in phase matrix, not in extinction and"
-               " absorption.")));
+               " absorption.",
+               "Number of photons per random number stream. A value of 0"
+               " or below traces all photons in sequence.")));
 
   md_data_raw.push_back(
       create_mdrecord(NAME("MCSetSeedFromTime"),
@@ -12869,13 +13052,16 @@ void define_md_data_raw() {
       GIN("manual_zeeman_tag",
           "manual_zeeman_magnetic_field_strength",
           "manual_zeeman_theta",
-          "manual_zeeman_eta"),
-      GIN_TYPE("Index", "Numeric", "Numeric", "Numeric"),
-      GIN_DEFAULT("0", "1.0", "0.0", "0.0"),
+          "manual_zeeman_eta",
+          "faddeeva_accuracy"),
+      GIN_TYPE("Index", "Numeric", "Numeric", "Numeric", "String"),
+      GIN_DEFAULT("0", "1.0", "0.0", "0.0", "Exact"),
       GIN_DESC("Manual angles tag",
                "Manual Magnetic Field Strength",
                "Manual theta given positive tag",
-               "Manual eta given positive tag")));
+               "Manual eta given positive tag",
+               "Accuracy of the Faddeeva function, as in"
+               " *abs_xsec_per_speciesAddLines*")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("propmat_clearskyInit"),
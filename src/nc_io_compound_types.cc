@@ -60,6 +60,7 @@ void nca_read_from_file(const int ncid, GasAbsLookup& gal, const Verbosity&) {
   nca_get_data_Vector(ncid, "t_pert", gal.t_pert, true);
   nca_get_data_Vector(ncid, "nls_pert", gal.nls_pert, true);
   nca_get_data_Tensor4(ncid, "xsec", gal.xsec, true);
+  gal.XsecStoreReset();
 }
 
 //! Writes a GasAbsLookup table to a NetCDF file
@@ -144,7 +145,10 @@ void nca_write_to_file(const int ncid,
   int t_ref_varid = nca_def_Vector(ncid, "t_ref", gal.t_ref);
   int t_pert_varid = nca_def_Vector(ncid, "t_pert", gal.t_pert);
   int nls_pert_varid = nca_def_Vector(ncid, "nls_pert", gal.nls_pert);
-  int xsec_varid = nca_def_Tensor4(ncid, "xsec", gal.xsec);
+  // Memory mapped and packed cross sections are written as doubles
+  const Tensor4 packed_xsec = gal.xsec_store ? gal.XsecUnpacked() : Tensor4();
+  const Tensor4& xsec = gal.xsec_store ? packed_xsec : gal.xsec;
+  int xsec_varid = nca_def_Tensor4(ncid, "xsec", xsec);
 
   if ((retval = nc_enddef(ncid))) nca_error(retval, "nc_enddef");
 
@@ -166,7 +170,7 @@ void nca_write_to_file(const int ncid,
   nca_put_var_Vector(ncid, t_ref_varid, gal.t_ref);
   nca_put_var_Vector(ncid, t_pert_varid, gal.t_pert);
   nca_put_var_Vector(ncid, nls_pert_varid, gal.nls_pert);
-  nca_put_var_Tensor4(ncid, xsec_varid, gal.xsec);
+  nca_put_var_Tensor4(ncid, xsec_varid, xsec);
 }
 
 ////////////////////////////////////////////////////////////////////////////
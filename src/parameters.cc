@@ -129,6 +129,7 @@ bool get_parameters(int argc, char **argv) {
       {"numthreads", required_argument, NULL, 'n'},
       {"outdir", required_argument, NULL, 'o'},
       {"plain", no_argument, NULL, 'p'},
+      {"profile", required_argument, NULL, 'P'},
       {"reporting", required_argument, NULL, 'r'},
 #ifdef ENABLE_DOCSERVER
       {"docserver", optional_argument, NULL, 's'},
@@ -140,7 +141,7 @@ bool get_parameters(int argc, char **argv) {
       {NULL, no_argument, NULL, 0}};
 
   parameters.usage =
-      "Usage: arts [-bBdghimnrsSvw]\n"
+      "Usage: arts [-bBdghimnPrsSvw]\n"
       "       [--basename <name>]\n"
       "       [--describe <method or variable>]\n"
       "       [--groups]\n"
@@ -152,6 +153,7 @@ bool get_parameters(int argc, char **argv) {
       "       [--numthreads <#>\n"
       "       [--outdir <name>]\n"
       "       [--plain]\n"
+      "       [--profile <file>]\n"
       "       [--reporting <xyz>]\n"
 #ifdef ENABLE_DOCSERVER
       "       [--docserver[=<port>] --baseurl=BASEURL]\n"
@@ -198,6 +200,10 @@ bool get_parameters(int argc, char **argv) {
       "                    Default is the current directory.\n"
       "-p  --plain         Generate plain help output suitable for\n"
       "                    script processing.\n"
+      "-P  --profile       Profile the methods executed by agendas. The call\n"
+      "                    tree per thread is written to the given file in\n"
+      "                    the folded stack format of flamegraph.pl and\n"
+      "                    printed as a table at the end of the run.\n"
       "-r, --reporting     Three digit integer. Sets the reporting\n"
       "                    level for agenda calls (first digit),\n"
       "                    screen (second digit) and file (third \n"
@@ -310,6 +316,9 @@ bool get_parameters(int argc, char **argv) {
       case 'p':
         parameters.plain = true;
         break;
+      case 'P':
+        parameters.profile = optarg;
+        break;
       case 'r': {
         //      cout << "optarg = " << optarg << endl;
         istringstream iss(optarg);
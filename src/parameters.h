@@ -65,7 +65,8 @@ class Parameters {
         baseurl(""),
         daemon(false),
         gui(false),
-        check_docs(false) { /* Nothing to be done here */
+        check_docs(false),
+        profile("") { /* Nothing to be done here */
     }
 
   /** Short message how to call the program. */
@@ -131,6 +132,11 @@ class Parameters {
   bool gui;
   /** Flag to check built-in documentation */
   bool check_docs;
+  /** If this is specified (with the -P --profile option), the methods
+      executed by agendas are profiled. The call tree is written to this
+      file in folded stack format and printed as a table at the end of the
+      run. */
+  String profile;
 };
 
 /**
@@ -2353,6 +2353,43 @@ void rtmethods_unit_conversion(
   }
 }
 
+void scalar_cumulative_transmission(Matrix& tot_tra, ConstMatrixView lyr_tra) {
+  const Index np = lyr_tra.nrows(), nf = lyr_tra.ncols();
+  tot_tra = lyr_tra;
+  for (Index ip = 1; ip < np; ip++)
+    for (Index iv = 0; iv < nf; iv++)
+      tot_tra(ip, iv) = tot_tra(ip - 1, iv) * lyr_tra(ip, iv);
+}
+
+void scalar_radiative_transfer(Matrix& ppvar_iy,
+                               ConstVectorView iy_last,
+                               ConstMatrixView lyr_tra,
+                               ConstMatrixView src) {
+  const Index np = lyr_tra.nrows(), nf = lyr_tra.ncols();
+  ppvar_iy.resize(np, nf);
+  ppvar_iy(np - 1, joker) = iy_last;
+  for (Index ip = np - 2; ip >= 0; ip--) {
+    if (src.nrows()) {
+      for (Index iv = 0; iv < nf; iv++) {
+        const Numeric avg = 0.5 * (src(ip, iv) + src(ip + 1, iv));
+        ppvar_iy(ip, iv) =
+            lyr_tra(ip + 1, iv) * (ppvar_iy(ip + 1, iv) - avg) + avg;
+      }
+    } else {
+      for (Index iv = 0; iv < nf; iv++)
+        ppvar_iy(ip, iv) = lyr_tra(ip + 1, iv) * ppvar_iy(ip + 1, iv);
+    }
+  }
+}
+
+void scalar_stepwise_transmission(VectorView lyr_tra,
+                                  ConstVectorView k1,
+                                  ConstVectorView k2,
+                                  const Numeric& r) {
+  for (Index iv = 0; iv < lyr_tra.nelem(); iv++)
+    lyr_tra[iv] = std::exp(-0.5 * r * (k1[iv] + k2[iv]));
+}
+
 void yCalc_mblock_loop_body(bool& failed,
                             String& fail_msg,
                             ArrayOfArrayOfVector& iyb_aux_array,
@@ -901,6 +901,60 @@ void rtmethods_unit_conversion(
     const Index& j_analytical_do,
     const String& iy_unit);
 
+/** Transmission of unpolarised radiation through all layers of a path.
+
+    The scalar engine of iyEmissionStandard and iyTransmissionStandard,
+    holding the layer transmissions as a plain matrix. Row ip of *lyr_tra*
+    is the transmission between ppath points ip-1 and ip, row 0 is 1.
+
+    @param[out]  tot_tra  Transmission from the first ppath point to each
+                          ppath point, as cumulative_transmission (Forward).
+    @param[in]   lyr_tra  Layer transmissions, (ppath point, frequency).
+
+    @author agent
+    @date   2026-10-18
+ */
+void scalar_cumulative_transmission(Matrix& tot_tra, ConstMatrixView lyr_tra);
+
+/** Radiative transfer of unpolarised radiation along a path.
+
+    The back-substitution of update_radiation_vector with the first order
+    solver, from the last ppath point to the first, for the scalar engine
+    of iyEmissionStandard and iyTransmissionStandard.
+
+    @param[out]  ppvar_iy  Radiance at each ppath point, (ppath point,
+                           frequency).
+    @param[in]   iy_last   Radiance at the last ppath point.
+    @param[in]   lyr_tra   Layer transmissions, see
+                           scalar_cumulative_transmission.
+    @param[in]   src       Source at each ppath point, or empty for pure
+                           transmission.
+
+    @author agent
+    @date   2026-10-18
+ */
+void scalar_radiative_transfer(Matrix& ppvar_iy,
+                               ConstVectorView iy_last,
+                               ConstMatrixView lyr_tra,
+                               ConstMatrixView src);
+
+/** Layer transmission of unpolarised radiation.
+
+    The scalar version of stepwise_transmission, without derivatives.
+
+    @param[out]  lyr_tra  Transmission through the layer, per frequency.
+    @param[in]   k1       Absorption at the first point of the layer.
+    @param[in]   k2       Absorption at the second point of the layer.
+    @param[in]   r        Distance through the layer.
+
+    @author agent
+    @date   2026-10-18
+ */
+void scalar_stepwise_transmission(VectorView lyr_tra,
+                                  ConstVectorView k1,
+                                  ConstVectorView k2,
+                                  const Numeric& r);
+
 /** Performs calculations for one measurement block, on y-level
  *
  * The parameters mainly matches WSVs.
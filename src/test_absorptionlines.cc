@@ -0,0 +1,249 @@
+/* Copyright (C) 2026
+ * agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+ * USA. */
+
+/*!
+ * @file   test_absorptionlines.cc
+ * @author agent <agent@local>
+ * @date   2026-10-18
+ *
+ * @brief  Test the data that Absorption::Lines derives from its lines
+ */
+
+#include <iostream>
+#include "absorptionlines.h"
+#include "linefunctions.h"
+
+/** The lines of a band that reach [fmin, fmax], by visiting all lines */
+ArrayOfIndex lines_in_range_by_scan(const AbsorptionLines& band,
+                                    const Numeric fmin,
+                                    const Numeric fmax) {
+  ArrayOfIndex out;
+  for (Index i = 0; i < band.NumLines(); i++)
+    if (band.CutoffFreq(i) >= fmin and band.CutoffFreqMinus(i, 0) <= fmax)
+      out.push_back(i);
+  return out;
+}
+
+/** Compares LinesInFrequencyRange with a scan over ranges around the lines */
+bool check_lines_in_range(const AbsorptionLines& band, const String& what) {
+  bool ok = true;
+  for (Index i = 0; i < band.NumLines(); i++) {
+    for (Numeric df : {0., 1e9, 5e9, 50e9}) {
+      const Numeric fmin = band.F0(i) - df;
+      const Numeric fmax = band.F0(i) + 0.5 * df;
+      if (band.LinesInFrequencyRange(fmin, fmax) not_eq
+          lines_in_range_by_scan(band, fmin, fmax)) {
+        std::cout << what << ": wrong lines for [" << fmin << ", " << fmax
+                  << "]\n";
+        ok = false;
+      }
+    }
+  }
+  return ok;
+}
+
+/** A Voigt band with line mixing and three broadening species
+ *
+ * Every line has its own line shape coefficients
+ */
+AbsorptionLines voigt_band() {
+  const ArrayOfSpeciesTag broadeners(3);
+  AbsorptionLines band(true,
+                       true,
+                       Absorption::CutoffType::None,
+                       Absorption::MirroringType::None,
+                       Absorption::PopulationType::ByLTE,
+                       Absorption::NormalizationType::None,
+                       LineShape::Type::VP,
+                       296,
+                       -1,
+                       5e3,
+                       QuantumIdentifier(),
+                       {},
+                       broadeners);
+
+  const std::vector<Numeric> F0s{118.75e9, 60.3e9, 62.5e9, 61.1e9, 119.9e9};
+  for (size_t k = 0; k < F0s.size(); k++) {
+    const Numeric x = 1 + 0.1 * Numeric(k);
+    LineShape::Model model(broadeners.nelem());
+    for (Index is = 0; is < broadeners.nelem(); is++) {
+      const Numeric y = x + 0.3 * Numeric(is);
+      auto& X = model.Data()[is].Data();
+      X[Index(LineShape::Variable::G0)] = {LineShape::TemperatureModel::T1, 2e4 * y, 0.7 + 0.01 * y};
+      X[Index(LineShape::Variable::D0)] = {LineShape::TemperatureModel::T1, -1e2 * y, 1.1};
+      X[Index(LineShape::Variable::Y)] = {LineShape::TemperatureModel::T3, 1e-6 * y, -1e-9};
+      X[Index(LineShape::Variable::G)] = {LineShape::TemperatureModel::T0, 1e-11 * y};
+      X[Index(LineShape::Variable::DV)] = {LineShape::TemperatureModel::T3, 1e-3 * y, 1e-5};
+    }
+    band.AppendSingleLine(Absorption::SingleLine(
+        F0s[k], 1e-20 * x, 1e-21 * x, 3, 5, 1e-3 * x, Zeeman::Model(), model));
+  }
+  return band;
+}
+
+/** Compares the hot view line shape parameters with Lines::ShapeParameters */
+bool check_hot_view_parameters(const AbsorptionLines& band,
+                               const String& what) {
+  const auto hotview = band.HotView();
+  const Vector vmrs{0.2, 0.3, 0.5};
+  ArrayOfIndex lines(band.NumLines());
+  for (Index i = 0; i < band.NumLines(); i++) lines[i] = i;
+
+  bool ok = hotview->NumLines() == band.NumLines();
+  std::vector<LineShape::Output> X;
+  for (Numeric P : {1e2, 1e4, 1e5}) {
+    for (Numeric T : {150., 296., 330.}) {
+      hotview->ShapeParameters(X, T, P, vmrs, lines);
+      for (Index i = 0; i < band.NumLines(); i++) {
+        const auto ref = band.ShapeParameters(i, T, P, vmrs);
+        if (hotview->F0(i) not_eq band.F0(i) or X[i].G0 not_eq ref.G0 or
+            X[i].D0 not_eq ref.D0 or X[i].G2 not_eq ref.G2 or
+            X[i].D2 not_eq ref.D2 or X[i].FVC not_eq ref.FVC or
+            X[i].ETA not_eq ref.ETA or X[i].Y not_eq ref.Y or
+            X[i].G not_eq ref.G or X[i].DV not_eq ref.DV) {
+          std::cout << what << ": line shape parameters of line " << i
+                    << " differ at P " << P << " and T " << T << '\n';
+          ok = false;
+        }
+      }
+    }
+  }
+
+  // A selection of the lines gives the parameters of these lines
+  const ArrayOfIndex selection{3, 1};
+  hotview->ShapeParameters(X, 250, 1e3, vmrs, selection);
+  for (Index il = 0; il < selection.nelem(); il++) {
+    const auto ref = band.ShapeParameters(selection[il], 250, 1e3, vmrs);
+    if (X[il].G0 not_eq ref.G0 or X[il].D0 not_eq ref.D0 or X[il].Y not_eq ref.Y) {
+      std::cout << what << ": line shape parameters of selected line "
+                << selection[il] << " differ\n";
+      ok = false;
+    }
+  }
+
+  return ok;
+}
+
+/** Compares the cross-section of a band with one by Lines::ShapeParameters
+ *
+ * The reference is the line loop of Linefunctions::set_cross_section_of_band
+ * for this band, with the line shape parameters of each line taken from
+ * Lines::ShapeParameters as before the hot view
+ */
+bool check_hot_view_xsec(const AbsorptionLines& band, const String& what) {
+  const Vector vmrs{0.2, 0.3, 0.5};
+  const Numeric T = 250, P = 3e4, DC = 2e-6;
+  Vector f_grid(1001);
+  for (Index iv = 0; iv < f_grid.nelem(); iv++)
+    f_grid[iv] = 50e9 + 80e6 * Numeric(iv);
+  const Index nf = f_grid.nelem();
+  ArrayOfIndex lines(band.NumLines());
+  for (Index i = 0; i < band.NumLines(); i++) lines[i] = i;
+
+  Linefunctions::InternalData scratch(nf, 0), sum(nf, 0);
+  Eigen::VectorXcd ref = Eigen::VectorXcd::Zero(nf);
+  for (Index i = 0; i < band.NumLines(); i++) {
+    const auto X = band.ShapeParameters(i, T, P, vmrs);
+    Linefunctions::set_voigt(scratch.F, scratch.dF, scratch.data,
+                             MapToEigen(f_grid), 0, 0, band.F0(i), DC, X,
+                             band, i);
+    Linefunctions::apply_linemixing_scaling_and_mirroring(
+        scratch.F, scratch.dF, scratch.N, scratch.dN, X, false, band, i);
+    Linefunctions::apply_linestrength_scaling_by_lte(
+        scratch.F, scratch.dF, scratch.N, scratch.dN, band.Line(i), T,
+        band.T0(), 1, 1, 1, band, i);
+    ref += scratch.F;
+  }
+
+  Linefunctions::set_cross_section_of_band(scratch,
+                                           sum,
+                                           f_grid,
+                                           band,
+                                           *band.HotView(),
+                                           lines,
+                                           ArrayOfRetrievalQuantity(),
+                                           ArrayOfIndex(),
+                                           vmrs,
+                                           EnergyLevelMap(),
+                                           P,
+                                           T,
+                                           1,
+                                           0,
+                                           DC,
+                                           0,
+                                           1,
+                                           0,
+                                           1);
+
+  if (sum.F not_eq ref) {
+    std::cout << what << ": cross-section differs from Lines::ShapeParameters"
+              << " by up to " << (sum.F - ref).cwiseAbs().maxCoeff() << '\n';
+    return false;
+  }
+  return true;
+}
+
+int main() {
+  AbsorptionLines band(false,
+                       false,
+                       Absorption::CutoffType::LineByLineOffset,
+                       Absorption::MirroringType::None,
+                       Absorption::PopulationType::ByLTE,
+                       Absorption::NormalizationType::None,
+                       LineShape::Type::VP,
+                       296,
+                       2e9);
+
+  // Lines out of frequency order, with two lines at the same frequency
+  for (Numeric F0 : {118e9, 22e9, 60e9, 183e9, 60e9, 61e9, 325e9, 59e9, 20e9})
+    band.AppendSingleLine(Absorption::SingleLine(F0));
+
+  bool ok = check_lines_in_range(band, "Initial band");
+
+  // Changes of the lines must be seen by the next search
+  band.F0(1) = 300e9;
+  ok = check_lines_in_range(band, "Changed line") and ok;
+  band.RemoveLine(3);
+  ok = check_lines_in_range(band, "Removed line") and ok;
+  band.AppendSingleLine(Absorption::SingleLine(90e9));
+  ok = check_lines_in_range(band, "Appended line") and ok;
+  band.sort_by_frequency();
+  ok = check_lines_in_range(band, "Sorted band") and ok;
+
+  // A copy keeps its own lines
+  AbsorptionLines copy = band;
+  copy.F0(0) = 1000e9;
+  ok = check_lines_in_range(band, "Original of changed copy") and ok;
+  ok = check_lines_in_range(copy, "Changed copy") and ok;
+
+  // The hot view gives the same as the lines, also after they are changed
+  AbsorptionLines voigt = voigt_band();
+  ok = check_hot_view_parameters(voigt, "Initial band") and ok;
+  ok = check_hot_view_xsec(voigt, "Initial band") and ok;
+  voigt.Line(2).LineShape().Data()[1].Data()[Index(LineShape::Variable::G0)].X0 *= 3;
+  ok = check_hot_view_parameters(voigt, "Changed line shape") and ok;
+  voigt.T0(250);
+  ok = check_hot_view_parameters(voigt, "Changed T0") and ok;
+  voigt.LinemixingLimit(-1);
+  ok = check_hot_view_parameters(voigt, "Changed line mixing limit") and ok;
+  voigt.RemoveLine(0);
+  ok = check_hot_view_parameters(voigt, "Removed line") and ok;
+  ok = check_hot_view_xsec(voigt, "Changed band") and ok;
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
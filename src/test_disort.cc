@@ -0,0 +1,200 @@
+/* Copyright (C) 2026
+ * agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+ * USA. */
+
+/*!
+ * @file   test_disort.cc
+ * @author agent <agent@local>
+ * @date   2026-10-18
+ *
+ * @brief  Test the cached Legendre moments of DISORT against get_pmom, and
+ *         that the cache is reused
+ */
+
+#include <cmath>
+#include <iostream>
+#include "disort.h"
+#include "math_funcs.h"
+
+extern const Numeric PI;
+
+/** A totally random element with a Henyey-Greenstein phase function
+ *
+ * The asymmetry parameter and the scattering cross section vary with
+ * frequency and temperature, so that the temperature interpolation of the
+ * cache is tested as well
+ *
+ * @param[in] T_grid The temperatures of the element
+ * @param[in] g0 Asymmetry parameter at the first frequency and temperature
+ * @param[in] sca0 Scattering cross section at the first frequency and
+ * temperature
+ * @return The element
+ */
+SingleScatteringData hg_element(const Vector& T_grid,
+                                const Numeric g0,
+                                const Numeric sca0) {
+  SingleScatteringData ssd;
+  ssd.ptype = PTYPE_TOTAL_RND;
+  ssd.description = "Henyey-Greenstein test element";
+  ssd.f_grid = {100e9, 200e9};
+  ssd.T_grid = T_grid;
+  nlinspace(ssd.za_grid, 0, 180, 181);
+
+  const Index nf = ssd.f_grid.nelem(), nT = T_grid.nelem();
+  const Index nza = ssd.za_grid.nelem();
+  ssd.pha_mat_data.resize(nf, nT, nza, 1, 1, 1, 6);
+  ssd.ext_mat_data.resize(nf, nT, 1, 1, 1);
+  ssd.abs_vec_data.resize(nf, nT, 1, 1, 1);
+  ssd.pha_mat_data = 0;
+
+  for (Index f = 0; f < nf; f++)
+    for (Index t = 0; t < nT; t++) {
+      const Numeric g = g0 + 0.1 * Numeric(f) + 1e-3 * (T_grid[t] - 250);
+      const Numeric sca = sca0 * (1 + Numeric(f)) * T_grid[t] / 250;
+      for (Index i = 0; i < nza; i++) {
+        const Numeric mu = std::cos(ssd.za_grid[i] * PI / 180);
+        const Numeric hg = (1 - g * g) /
+                           std::pow(1 + g * g - 2 * g * mu, 1.5) / (4 * PI);
+        ssd.pha_mat_data(f, t, i, 0, 0, 0, 0) = sca * hg;
+        ssd.pha_mat_data(f, t, i, 0, 0, 0, 1) = sca * hg;
+      }
+      ssd.ext_mat_data(f, t, 0, 0, 0) = 1.5 * sca;
+      ssd.abs_vec_data(f, t, 0, 0, 0) = 0.5 * sca;
+    }
+  return ssd;
+}
+
+int main() {
+  // Elements with three, one and two temperatures
+  ArrayOfArrayOfSingleScatteringData scat_data(2);
+  scat_data[0].push_back(hg_element({200, 250, 300}, 0.3, 1e-9));
+  scat_data[0].push_back(hg_element({250}, 0.5, 2e-9));
+  scat_data[1].push_back(hg_element({220, 280}, 0.2, 5e-10));
+
+  // Six levels, the cloudbox covering the lower five
+  const Vector t_profile{275, 265, 255, 245, 235, 225};
+  const ArrayOfIndex cloudbox_limits{0, 4};
+  const Index Np = t_profile.nelem(), Np_cloud = 5, nlyr = Np - 1;
+  Matrix pnd(3, Np_cloud);
+  for (Index i = 0; i < Np_cloud; i++) {
+    pnd(0, i) = 1e3 * Numeric(i + 1);
+    pnd(1, i) = i == 2 ? 0 : 5e2;
+    pnd(2, i) = 2e3 / Numeric(i + 1);
+  }
+
+  // The optical properties as get_paroptprop gives them, with the cross
+  // sections interpolated linearly in temperature
+  const Index nf = 2;
+  Matrix ext_bulk_par(nf, Np, 0.), abs_bulk_par(nf, Np, 0.);
+  Index ie = 0;
+  for (auto& ss : scat_data)
+    for (auto& ssd : ss) {
+      const Index nT = ssd.T_grid.nelem();
+      for (Index f = 0; f < nf; f++)
+        for (Index i = 0; i < Np_cloud; i++) {
+          Index t = 0;
+          while (t < nT - 2 and ssd.T_grid[t + 1] < t_profile[i]) t++;
+          const Numeric w =
+              nT == 1 ? 0
+                      : (t_profile[i] - ssd.T_grid[t]) /
+                            (ssd.T_grid[t + 1] - ssd.T_grid[t]);
+          const Index t1 = nT == 1 ? t : t + 1;
+          ext_bulk_par(f, i) += pnd(ie, i) *
+                                ((1 - w) * ssd.ext_mat_data(f, t, 0, 0, 0) +
+                                 w * ssd.ext_mat_data(f, t1, 0, 0, 0));
+          abs_bulk_par(f, i) += pnd(ie, i) *
+                                ((1 - w) * ssd.abs_vec_data(f, t, 0, 0, 0) +
+                                 w * ssd.abs_vec_data(f, t1, 0, 0, 0));
+        }
+      ie++;
+    }
+
+  const Index Nlegendre = 16;
+  Vector pfct_angs;
+  get_angs(pfct_angs, scat_data, 181);
+  const Index nang = pfct_angs.nelem();
+
+  // The chain of run_cdisort before the cache
+  Tensor3 pha_bulk_par(nf, Np, nang);
+  get_parZ(pha_bulk_par, scat_data, pnd, t_profile, pfct_angs, cloudbox_limits);
+  Tensor3 pfct_bulk_par(nf, nlyr, nang);
+  get_pfct(pfct_bulk_par,
+           pha_bulk_par,
+           ext_bulk_par,
+           abs_bulk_par,
+           cloudbox_limits);
+  Tensor3 pmom_ref(nf, nlyr, Nlegendre, 0.);
+  get_pmom(pmom_ref, pfct_bulk_par, pfct_angs, Nlegendre);
+
+  // The cached moments
+  DisortPhaseCache cache;
+  bool ok = get_phase_cache(cache, scat_data, pfct_angs, Nlegendre);
+  Tensor3 pmom(nf, nlyr, Nlegendre, 0.);
+  get_pmom_cached(pmom,
+                  cache,
+                  scat_data,
+                  pnd,
+                  t_profile,
+                  ext_bulk_par,
+                  abs_bulk_par,
+                  cloudbox_limits);
+
+  Numeric max_err = 0;
+  for (Index f = 0; f < nf; f++)
+    for (Index il = 0; il < nlyr; il++)
+      for (Index l = 0; l < Nlegendre; l++)
+        max_err =
+            std::max(max_err, std::abs(pmom(f, il, l) - pmom_ref(f, il, l)));
+
+  const Numeric limit = 1e-12;
+  std::cout << "Cached Legendre moments: max absolute error " << max_err
+            << " (limit " << limit << ")\n";
+  ok = max_err <= limit and ok;
+
+  // A second call, as by the next case of a batch, hits the cache. The
+  // cache of a batch scope is used instead of the caller's own.
+  DisortPhaseCache own_cache;
+  {
+    DisortPhaseCacheScope scope(cache);
+    if (&DisortPhaseCacheScope::Current(own_cache) not_eq &cache or
+        get_phase_cache(DisortPhaseCacheScope::Current(own_cache),
+                        scat_data,
+                        pfct_angs,
+                        Nlegendre)) {
+      std::cout << "Second call with the same input misses the cache\n";
+      ok = false;
+    }
+  }
+  if (&DisortPhaseCacheScope::Current(own_cache) not_eq &own_cache) {
+    std::cout << "Cache of a closed batch scope is still used\n";
+    ok = false;
+  }
+
+  // Other input misses the cache
+  if (not get_phase_cache(cache, scat_data, pfct_angs, Nlegendre + 1) or
+      not get_phase_cache(cache, scat_data, pfct_angs, Nlegendre)) {
+    std::cout << "Call with another Nlegendre hits the cache\n";
+    ok = false;
+  }
+  scat_data[1][0].pha_mat_data(0, 0, 0, 0, 0, 0, 0) *= 2;
+  if (not get_phase_cache(cache, scat_data, pfct_angs, Nlegendre)) {
+    std::cout << "Call with scattering data changed in place hits the cache\n";
+    ok = false;
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,145 @@
+/* Copyright (C) 2026
+ * agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+ * USA. */
+
+/*!
+ * @file   test_doit.cc
+ * @author agent <agent@local>
+ * @date   2026-10-18
+ *
+ * @brief  Test the convergence acceleration of the DOIT iteration
+ */
+
+#include <cmath>
+#include <iostream>
+#include "doit.h"
+
+/** One step of a model of the DOIT iteration in a 1D cloudbox
+ *
+ * The field at each level and direction is a source term plus the fraction
+ * albedo of the field scattered from the directions of the same level and
+ * from the neighbouring levels.  Radiation leaves the cloudbox at the top
+ * and the bottom.  With an albedo close to 1 the cloud is optically thick
+ * and the iteration converges slowly, as in DOIT.
+ */
+void model_step(Tensor6& field, const Tensor6& old, const Numeric albedo) {
+  const Index N_p = field.nvitrines(), N_za = field.npages();
+  for (Index p = 0; p < N_p; p++) {
+    Numeric mean = 0;
+    for (Index za = 0; za < N_za; za++) mean += old(p, 0, 0, za, 0, 0);
+    mean /= Numeric(N_za);
+    for (Index za = 0; za < N_za; za++) {
+      const Numeric below = p > 0 ? old(p - 1, 0, 0, za, 0, 0) : 0;
+      const Numeric above = p < N_p - 1 ? old(p + 1, 0, 0, za, 0, 0) : 0;
+      field(p, 0, 0, za, 0, 0) =
+          1 + 0.1 * Numeric(za) +
+          albedo * (0.5 * mean + 0.25 * below + 0.25 * above);
+    }
+  }
+}
+
+/** Iterates the model as cloudbox_field_monoIterate until convergence
+ *
+ * The convergence test is that of doit_conv_flagAbs.  Anderson acceleration
+ * combines memory previous steps.  Returns the number of iteration steps, or
+ * max_iterations + 1 if the iteration did not converge.
+ */
+Index iterate(Tensor6& field,
+              const String& acceleration_method,
+              const Index memory,
+              const Numeric albedo,
+              const Index max_iterations) {
+  const Verbosity verbosity;
+  const Numeric epsilon = 1e-8;
+  field = Tensor6(40, 1, 1, 16, 1, 1, 0.);
+  Tensor6 old;
+  ArrayOfTensor6 acceleration_input(4);
+  ArrayOfVector anderson_x, anderson_g;
+
+  for (Index n = 1; n <= max_iterations; n++) {
+    old = field;
+    model_step(field, old, albedo);
+
+    Numeric change = 0;
+    for (Index p = 0; p < field.nvitrines(); p++)
+      for (Index za = 0; za < field.npages(); za++)
+        change = std::max(
+            change, std::abs(field(p, 0, 0, za, 0, 0) - old(p, 0, 0, za, 0, 0)));
+    if (change < epsilon) return n;
+
+    if (acceleration_method == "Anderson") {
+      cloudbox_field_andersonAcceleration(
+          field, anderson_x, anderson_g, old, 1, memory, verbosity);
+    } else if (acceleration_method == "NG") {
+      acceleration_input[(n - 1) % 4] = field;
+      if (n % 4 == 0)
+        cloudbox_field_ngAcceleration(field, acceleration_input, 1, verbosity);
+    }
+  }
+  return max_iterations + 1;
+}
+
+int main() {
+  const Index max_iterations = 10000;
+  bool ok = true;
+
+  for (Numeric albedo : {0.9, 0.99}) {
+    // Anderson with the default memory of cloudbox_field_monoIterate and
+    // with a long memory
+    Tensor6 none, ng, anderson, anderson_long;
+    const Index n_none = iterate(none, "None", 0, albedo, max_iterations);
+    const Index n_ng = iterate(ng, "NG", 0, albedo, max_iterations);
+    const Index n_anderson =
+        iterate(anderson, "Anderson", 5, albedo, max_iterations);
+    const Index n_anderson_long =
+        iterate(anderson_long, "Anderson", 20, albedo, max_iterations);
+    std::cout << "Albedo " << albedo << ": " << n_none << " iterations, "
+              << n_ng << " with NG, " << n_anderson << " with Anderson and "
+              << n_anderson_long << " with Anderson of memory 20\n";
+
+    if (n_none > max_iterations or n_ng > max_iterations or
+        n_anderson > max_iterations or n_anderson_long > max_iterations) {
+      std::cout << "  An iteration did not converge\n";
+      ok = false;
+      continue;
+    }
+
+    // All methods find the same field
+    Numeric max_diff = 0;
+    for (const Tensor6* field : {&ng, &anderson, &anderson_long})
+      for (Index p = 0; p < none.nvitrines(); p++)
+        for (Index za = 0; za < none.npages(); za++)
+          max_diff = std::max(max_diff,
+                              std::abs((*field)(p, 0, 0, za, 0, 0) -
+                                       none(p, 0, 0, za, 0, 0)) /
+                                  none(p, 0, 0, za, 0, 0));
+    if (max_diff > 1e-4) {
+      std::cout << "  The accelerated fields differ by up to " << max_diff
+                << '\n';
+      ok = false;
+    }
+
+    // Anderson needs fewer iteration steps than NG, and a long memory
+    // fewer still
+    if (n_anderson >= n_ng or n_anderson_long >= n_anderson) {
+      std::cout << "  Anderson does not converge faster than NG\n";
+      ok = false;
+    }
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
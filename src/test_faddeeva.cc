@@ -0,0 +1,82 @@
+/* Copyright (C) 2026
+ * agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+ * USA. */
+
+/*!
+ * @file   test_faddeeva.cc
+ * @author agent <agent@local>
+ * @date   2026-10-17
+ *
+ * @brief  Test the block-wise Faddeeva function against Faddeeva::w
+ */
+
+#include <Faddeeva/Faddeeva.hh>
+#include <iostream>
+#include "faddeeva_block.h"
+
+/** Returns the largest relative error of a tier over a grid of arguments
+ *
+ * The grid covers the line center, the near and far wings out to |x|=1e4,
+ * and the pressure broadened to Doppler broadened width ratios of typical
+ * atmospheric lines.  Negative y is included to cover mirrored lines
+ */
+Numeric max_relative_error(const FaddeevaBlock::Accuracy accuracy) {
+  const std::vector<Numeric> ys{-1e-2, -1e-4, 0, 1e-8, 1e-6, 1e-4, 1e-2,
+                                0.1,   0.5,   1, 3,    10,   100,  1e3};
+
+  Eigen::VectorXd xs(4003);
+  for (Index i = 0; i < 2001; i++) xs[i] = -50 + 0.05 * Numeric(i);
+  for (Index i = 0; i < 1001; i++) xs[2001 + i] = std::pow(10, -3 + 7e-3 * Numeric(i));
+  for (Index i = 0; i < 1001; i++) xs[3002 + i] = -xs[2001 + i];
+
+  Numeric max_err = 0;
+  Eigen::VectorXcd z(xs.size()), W(xs.size());
+  for (auto y : ys) {
+    for (Index i = 0; i < xs.size(); i++) z[i] = Complex(xs[i], y);
+
+    FaddeevaBlock::w(W, z, accuracy);
+    for (Index i = 0; i < z.size(); i++) {
+      const Complex ref = Faddeeva::w(z[i]);
+      max_err = std::max(max_err, std::abs(W[i] - ref) / std::abs(ref));
+    }
+
+    // Same memory for input and output must give the same answer
+    FaddeevaBlock::w(z, z, accuracy);
+    for (Index i = 0; i < z.size(); i++)
+      max_err = std::max(max_err, std::abs(W[i] - z[i]) / std::abs(W[i]));
+  }
+
+  return max_err;
+}
+
+int main() {
+  const std::vector<std::pair<FaddeevaBlock::Accuracy, Numeric>> tiers{
+      {FaddeevaBlock::Accuracy::Exact, 0},
+      {FaddeevaBlock::Accuracy::High, 1e-12},
+      {FaddeevaBlock::Accuracy::Fast, 1e-6}};
+
+  bool ok = true;
+  for (auto& tier : tiers) {
+    const Numeric err = max_relative_error(tier.first);
+    std::cout << FaddeevaBlock::accuracy2string(tier.first)
+              << ": max relative error " << err << " (limit " << tier.second
+              << ")\n";
+    if (not(err <= tier.second)) ok = false;
+  }
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
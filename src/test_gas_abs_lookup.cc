@@ -0,0 +1,116 @@
+/* Copyright (C) 2026
+ * agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+ * USA. */
+
+/*!
+ * @file   test_gas_abs_lookup.cc
+ * @author agent <agent@local>
+ * @date   2026-10-18
+ *
+ * @brief  Test the extraction of absorption from GasAbsLookup
+ */
+
+#include <cmath>
+#include <iostream>
+#include "arts.h"
+#include "gas_abs_lookup.h"
+
+/** A table of H2O and O2, with H2O as nonlinear species
+ *
+ * The cross sections vary smoothly with every dimension of the table
+ */
+GasAbsLookup test_table(const Verbosity& verbosity) {
+  GasAbsLookup table;
+  table.Species() = ArrayOfArrayOfSpeciesTag{ArrayOfSpeciesTag{SpeciesTag("H2O")},
+                                             ArrayOfSpeciesTag{SpeciesTag("O2")}};
+  table.NonLinearSpecies() = ArrayOfIndex{0};
+  nlinspace(table.Fgrid(), 50e9, 150e9, 21);
+  nlogspace(table.Pgrid(), 1e5, 1e2, 12);
+  nlinspace(table.Tpert(), -40, 40, 5);
+  nlinspace(table.NLSPert(), 0, 2, 4);
+
+  const Index np = table.Pgrid().nelem(), nf = table.Fgrid().nelem();
+  table.Tref() = Vector(np, 250);
+  table.VMRs() = Matrix(2, np);
+  table.VMRs()(0, joker) = 0.01;
+  table.VMRs()(1, joker) = 0.21;
+
+  // Species plus the perturbations of the nonlinear species but one
+  const Index nt = table.Tpert().nelem();
+  const Index ns = 2 + table.NLSPert().nelem() - 1;
+  table.Xsec() = Tensor4(nt, ns, nf, np);
+  for (Index it = 0; it < nt; it++)
+    for (Index is = 0; is < ns; is++)
+      for (Index iv = 0; iv < nf; iv++)
+        for (Index ip = 0; ip < np; ip++)
+          table.Xsec()(it, is, iv, ip) =
+              1e-25 * (1 + 0.1 * Numeric(is)) *
+              std::exp(0.01 * Numeric(it * iv) - 0.2 * Numeric(ip)) *
+              (2 + std::sin(0.3 * Numeric(iv + 2 * ip)));
+
+  table.Adapt(table.Species(), table.Fgrid(), false, verbosity);
+  return table;
+}
+
+/** Compares ExtractBatch with Extract for each of n points */
+bool check_extract_batch(const GasAbsLookup& table, const Index n) {
+  Vector p(n), T(n);
+  Matrix vmrs(2, n);
+  for (Index i = 0; i < n; i++) {
+    const Numeric x = (Numeric(i) + 0.5) / Numeric(n);
+    p[i] = 2e2 * std::pow(400., x);
+    T[i] = 220 + 60 * x;
+    vmrs(0, i) = 0.002 + 0.015 * x;
+    vmrs(1, i) = 0.21;
+  }
+  Vector f_grid;
+  nlinspace(f_grid, 52e9, 148e9, 31);
+
+  Tensor3 batch;
+  table.ExtractBatch(batch, 2, 2, 1, 1, p, T, vmrs, f_grid, 0.5);
+
+  bool ok = batch.npages() == n;
+  Matrix single;
+  for (Index i = 0; ok and i < n; i++) {
+    table.Extract(
+        single, 2, 2, 1, 1, p[i], T[i], vmrs(joker, i), f_grid, 0.5);
+    bool same = true;
+    for (Index is = 0; is < single.nrows(); is++)
+      for (Index iv = 0; iv < single.ncols(); iv++)
+        same = same and batch(i, is, iv) == single(is, iv);
+    if (not same) {
+      std::cout << "ExtractBatch of " << n << " points differs from Extract"
+                << " for point " << i << '\n';
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+int main() {
+  define_species_data();
+  define_species_map();
+
+  const Verbosity verbosity;
+  const GasAbsLookup table = test_table(verbosity);
+
+  // A serial and a parallel batch
+  bool ok = check_extract_batch(table, 2);
+  ok = check_extract_batch(table, 40) and ok;
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
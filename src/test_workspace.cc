@@ -0,0 +1,179 @@
+/* Copyright (C) 2026
+ * agent <agent@local>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2, or (at your option) any
+ * later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+ * USA. */
+
+/*!
+ * @file   test_workspace.cc
+ * @author agent <agent@local>
+ * @date   2026-10-18
+ *
+ * @brief  Test that copies of a workspace keep their changes to themselves
+ */
+
+#include <iostream>
+#include "agenda_record.h"
+#include "arts.h"
+#include "global_data.h"
+#include "matpackI.h"
+#include "workspace_ng.h"
+
+Index& index_wsv(Workspace& ws, Index i) {
+  return *static_cast<Index*>(ws[i]);
+}
+
+Vector& vector_wsv(Workspace& ws, Index i) {
+  return *static_cast<Vector*>(ws[i]);
+}
+
+bool same(const Vector& a, const Vector& b) {
+  if (a.nelem() not_eq b.nelem()) return false;
+  for (Index i = 0; i < a.nelem(); i++)
+    if (a[i] not_eq b[i]) return false;
+  return true;
+}
+
+bool check(bool condition, const String& what) {
+  if (not condition) std::cout << what << '\n';
+  return condition;
+}
+
+int main() {
+  define_wsv_group_names();
+  Workspace::define_wsv_data();
+  Workspace::define_wsv_map();
+  define_agenda_data();
+  define_agenda_map();
+  global_data::workspace_memory_handler.initialize();
+
+  const Index stokes_dim = Workspace::WsvMap.at("stokes_dim");
+  const Index f_grid = Workspace::WsvMap.at("f_grid");
+  const Index p_grid = Workspace::WsvMap.at("p_grid");
+
+  Workspace parent;
+  parent.initialize();
+  index_wsv(parent, stokes_dim) = 1;
+  vector_wsv(parent, f_grid) = Vector{1e9, 2e9, 3e9};
+  const Vector f_grid_parent = vector_wsv(parent, f_grid);
+
+  bool ok = true;
+  {
+    Workspace fork(parent);
+    ok = check(fork.nelem() == parent.nelem(), "Fork has another size") and ok;
+    ok = check(fork.is_initialized(stokes_dim) and
+                   not fork.is_initialized(p_grid),
+               "Fork does not see the variables of the parent") and
+         ok;
+
+    // A copy of the untouched fork sees the same variables
+    Workspace fork_of_fork(fork);
+    ok = check(index_wsv(fork_of_fork, stokes_dim) == 1,
+               "Fork of fork does not see the variables of the parent") and
+         ok;
+
+    // Writing a duplicate in the fork
+    fork.duplicate(stokes_dim);
+    index_wsv(fork, stokes_dim) = 4;
+    ok = check(index_wsv(parent, stokes_dim) == 1,
+               "Write of duplicate in fork changed parent") and
+         ok;
+    ok = check(index_wsv(fork_of_fork, stokes_dim) == 1,
+               "Write of duplicate in fork changed fork of fork") and
+         ok;
+    fork.pop_free(stokes_dim);
+    ok = check(index_wsv(fork, stokes_dim) == 1,
+               "Fork does not see the parent after pop_free") and
+         ok;
+
+    // Writing a duplicate in the fork of the fork
+    fork_of_fork.duplicate(f_grid);
+    vector_wsv(fork_of_fork, f_grid)[0] = 5e9;
+    ok = check(same(vector_wsv(parent, f_grid), f_grid_parent),
+               "Write of duplicate in fork of fork changed parent") and
+         ok;
+    fork_of_fork.del(f_grid);
+    ok = check(not fork_of_fork.is_initialized(f_grid),
+               "Deleted duplicate in fork of fork is initialized") and
+         ok;
+
+    // Deleting and popping shared variables in the fork only drops them
+    fork.del(f_grid);
+    ok = check(not fork.is_initialized(f_grid), "Deleted f_grid in fork") and
+         ok;
+    ok = check(parent.is_initialized(f_grid) and
+                   same(vector_wsv(parent, f_grid), f_grid_parent),
+               "Delete in fork changed parent") and
+         ok;
+    fork.pop(stokes_dim);
+    ok = check(fork.depth(stokes_dim) == 0, "Popped stokes_dim in fork") and
+         ok;
+    ok = check(parent.depth(stokes_dim) == 1 and
+                   index_wsv(parent, stokes_dim) == 1,
+               "Pop in fork changed parent") and
+         ok;
+
+    // A fork allocates its own variables that the parent does not have
+    vector_wsv(fork, p_grid) = Vector{1e5, 1e4};
+    ok = check(not parent.is_initialized(p_grid),
+               "Variable allocated in fork is initialized in parent") and
+         ok;
+  }
+
+  {
+    Workspace fork(parent);
+
+    // Writing a duplicate in the parent
+    parent.duplicate(stokes_dim);
+    index_wsv(parent, stokes_dim) = 3;
+    ok = check(index_wsv(fork, stokes_dim) == 1,
+               "Write of duplicate in parent changed fork") and
+         ok;
+    parent.pop_free(stokes_dim);
+
+    // Deleting and popping a duplicate in the parent
+    parent.duplicate(f_grid);
+    vector_wsv(parent, f_grid)[1] = 6e9;
+    parent.del(f_grid);
+    ok = check(same(vector_wsv(fork, f_grid), f_grid_parent),
+               "Delete of duplicate in parent changed fork") and
+         ok;
+    parent.pop(f_grid);
+    ok = check(same(vector_wsv(parent, f_grid), f_grid_parent),
+               "Parent does not see its variable after pop") and
+         ok;
+
+    // A fork of a used fork sees its changes, but not the other way round
+    fork.duplicate(stokes_dim);
+    index_wsv(fork, stokes_dim) = 2;
+    Workspace fork_of_fork(fork);
+    ok = check(index_wsv(fork_of_fork, stokes_dim) == 2,
+               "Fork of used fork does not see its variables") and
+         ok;
+    fork_of_fork.duplicate(stokes_dim);
+    index_wsv(fork_of_fork, stokes_dim) = 8;
+    ok = check(index_wsv(fork, stokes_dim) == 2 and
+                   index_wsv(parent, stokes_dim) == 1,
+               "Write of duplicate in fork of used fork changed its parents") and
+         ok;
+  }
+
+  ok = check(index_wsv(parent, stokes_dim) == 1 and
+                 same(vector_wsv(parent, f_grid), f_grid_parent),
+             "Parent changed after the forks were destroyed") and
+       ok;
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -105,9 +105,10 @@ inline void transmat1(TransmissionMatrix& T,
                       const Numeric& r,
                       const Index iz = 0,
                       const Index ia = 0) noexcept {
+  const ConstVectorView k1_kjj = K1.Kjj(iz, ia);
+  const ConstVectorView k2_kjj = K2.Kjj(iz, ia);
   for (Index i = 0; i < K1.NumberOfFrequencies(); i++)
-    T.Mat1(i)(0, 0) =
-        std::exp(-0.5 * r * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i]));
+    T.Mat1(i)(0, 0) = std::exp(-0.5 * r * (k1_kjj[i] + k2_kjj[i]));
 }
 
 inline void transmat2(TransmissionMatrix& T,
@@ -116,9 +117,13 @@ inline void transmat2(TransmissionMatrix& T,
                       const Numeric& r,
                       const Index iz = 0,
                       const Index ia = 0) noexcept {
+  const ConstVectorView k1_kjj = K1.Kjj(iz, ia),
+                        k1_k12 = K1.K12(iz, ia);
+  const ConstVectorView k2_kjj = K2.Kjj(iz, ia),
+                        k2_k12 = K2.K12(iz, ia);
   for (Index i = 0; i < K1.NumberOfFrequencies(); i++) {
-    const Numeric a = -0.5 * r * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i]),
-                  b = -0.5 * r * (K1.K12(iz, ia)[i] + K2.K12(iz, ia)[i]);
+    const Numeric a = -0.5 * r * (k1_kjj[i] + k2_kjj[i]),
+                  b = -0.5 * r * (k1_k12[i] + k2_k12[i]);
     const Numeric exp_a = std::exp(a);
     const Numeric cb = std::cosh(b), sb = std::sinh(b);
     T.Mat2(i).noalias() =
@@ -132,11 +137,19 @@ inline void transmat3(TransmissionMatrix& T,
                       const Numeric& r,
                       const Index iz = 0,
                       const Index ia = 0) noexcept {
+  const ConstVectorView k1_kjj = K1.Kjj(iz, ia),
+                        k1_k12 = K1.K12(iz, ia),
+                        k1_k13 = K1.K13(iz, ia),
+                        k1_k23 = K1.K23(iz, ia);
+  const ConstVectorView k2_kjj = K2.Kjj(iz, ia),
+                        k2_k12 = K2.K12(iz, ia),
+                        k2_k13 = K2.K13(iz, ia),
+                        k2_k23 = K2.K23(iz, ia);
   for (Index i = 0; i < K1.NumberOfFrequencies(); i++) {
-    const Numeric a = -0.5 * r * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i]),
-                  b = -0.5 * r * (K1.K12(iz, ia)[i] + K2.K12(iz, ia)[i]),
-                  c = -0.5 * r * (K1.K13(iz, ia)[i] + K2.K13(iz, ia)[i]),
-                  u = -0.5 * r * (K1.K23(iz, ia)[i] + K2.K23(iz, ia)[i]);
+    const Numeric a = -0.5 * r * (k1_kjj[i] + k2_kjj[i]),
+                  b = -0.5 * r * (k1_k12[i] + k2_k12[i]),
+                  c = -0.5 * r * (k1_k13[i] + k2_k13[i]),
+                  u = -0.5 * r * (k1_k23[i] + k2_k23[i]);
     const Numeric exp_a = std::exp(a);
 
     if (b == 0. and c == 0. and u == 0.)
@@ -195,15 +208,29 @@ inline void transmat4(TransmissionMatrix& T,
                       const Numeric& r,
                       const Index iz = 0,
                       const Index ia = 0) noexcept {
+  const ConstVectorView k1_kjj = K1.Kjj(iz, ia),
+                        k1_k12 = K1.K12(iz, ia),
+                        k1_k13 = K1.K13(iz, ia),
+                        k1_k14 = K1.K14(iz, ia),
+                        k1_k23 = K1.K23(iz, ia),
+                        k1_k24 = K1.K24(iz, ia),
+                        k1_k34 = K1.K34(iz, ia);
+  const ConstVectorView k2_kjj = K2.Kjj(iz, ia),
+                        k2_k12 = K2.K12(iz, ia),
+                        k2_k13 = K2.K13(iz, ia),
+                        k2_k14 = K2.K14(iz, ia),
+                        k2_k23 = K2.K23(iz, ia),
+                        k2_k24 = K2.K24(iz, ia),
+                        k2_k34 = K2.K34(iz, ia);
   static constexpr Numeric sqrt_05 = Constant::inv_sqrt_2;
   for (Index i = 0; i < K1.NumberOfFrequencies(); i++) {
-    const Numeric a = -0.5 * r * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i]),
-                  b = -0.5 * r * (K1.K12(iz, ia)[i] + K2.K12(iz, ia)[i]),
-                  c = -0.5 * r * (K1.K13(iz, ia)[i] + K2.K13(iz, ia)[i]),
-                  d = -0.5 * r * (K1.K14(iz, ia)[i] + K2.K14(iz, ia)[i]),
-                  u = -0.5 * r * (K1.K23(iz, ia)[i] + K2.K23(iz, ia)[i]),
-                  v = -0.5 * r * (K1.K24(iz, ia)[i] + K2.K24(iz, ia)[i]),
-                  w = -0.5 * r * (K1.K34(iz, ia)[i] + K2.K34(iz, ia)[i]);
+    const Numeric a = -0.5 * r * (k1_kjj[i] + k2_kjj[i]),
+                  b = -0.5 * r * (k1_k12[i] + k2_k12[i]),
+                  c = -0.5 * r * (k1_k13[i] + k2_k13[i]),
+                  d = -0.5 * r * (k1_k14[i] + k2_k14[i]),
+                  u = -0.5 * r * (k1_k23[i] + k2_k23[i]),
+                  v = -0.5 * r * (k1_k24[i] + k2_k24[i]),
+                  w = -0.5 * r * (k1_k34[i] + k2_k34[i]);
     const Numeric exp_a = std::exp(a);
 
     if (b == 0. and c == 0. and d == 0. and u == 0. and v == 0. and w == 0.)
@@ -324,23 +351,24 @@ inline void dtransmat1(TransmissionMatrix& T,
                        const Index it,
                        const Index iz,
                        const Index ia) noexcept {
+  const ConstVectorView k1_kjj = K1.Kjj(iz, ia);
+  const ConstVectorView k2_kjj = K2.Kjj(iz, ia);
   for (Index i = 0; i < K1.NumberOfFrequencies(); i++) {
-    T.Mat1(i)(0, 0) =
-        std::exp(-0.5 * r * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i]));
+    T.Mat1(i)(0, 0) = std::exp(-0.5 * r * (k1_kjj[i] + k2_kjj[i]));
     for (Index j = 0; j < dT1.nelem(); j++) {
       if (dK1[j].NumberOfFrequencies())
         dT1[j].Mat1(i)(0, 0) =
             T.Mat1(i)(0, 0) *
             (-0.5 *
              (r * dK1[j].Kjj(iz, ia)[i] +
-              ((j == it) ? dr_dT1 * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i])
+              ((j == it) ? dr_dT1 * (k1_kjj[i] + k2_kjj[i])
                          : 0.0)));
       if (dK2[j].NumberOfFrequencies())
         dT2[j].Mat1(i)(0, 0) =
             T.Mat1(i)(0, 0) *
             (-0.5 *
              (r * dK2[j].Kjj(iz, ia)[i] +
-              ((j == it) ? dr_dT2 * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i])
+              ((j == it) ? dr_dT2 * (k1_kjj[i] + k2_kjj[i])
                          : 0.0)));
     }
   }
@@ -359,9 +387,13 @@ inline void dtransmat2(TransmissionMatrix& T,
                        const Index it,
                        const Index iz,
                        const Index ia) noexcept {
+  const ConstVectorView k1_kjj = K1.Kjj(iz, ia),
+                        k1_k12 = K1.K12(iz, ia);
+  const ConstVectorView k2_kjj = K2.Kjj(iz, ia),
+                        k2_k12 = K2.K12(iz, ia);
   for (Index i = 0; i < K1.NumberOfFrequencies(); i++) {
-    const Numeric a = -0.5 * r * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i]),
-                  b = -0.5 * r * (K1.K12(iz, ia)[i] + K2.K12(iz, ia)[i]);
+    const Numeric a = -0.5 * r * (k1_kjj[i] + k2_kjj[i]),
+                  b = -0.5 * r * (k1_k12[i] + k2_k12[i]);
     const Numeric exp_a = std::exp(a);
     const Numeric cb = std::cosh(b), sb = std::sinh(b);
     T.Mat2(i).noalias() =
@@ -369,12 +401,12 @@ inline void dtransmat2(TransmissionMatrix& T,
     for (Index j = 0; j < dT1.nelem(); j++) {
       if (dK1[j].NumberOfFrequencies()) {
         const Numeric da = -0.5 * (r * dK1[j].Kjj(iz, ia)[i] +
-                                   ((j == it) ? dr_dT1 * (K1.Kjj(iz, ia)[i] +
-                                                          K2.Kjj(iz, ia)[i])
+                                   ((j == it) ? dr_dT1 * (k1_kjj[i] +
+                                                          k2_kjj[i])
                                               : 0.0)),
                       db = -0.5 * (r * dK1[j].K12(iz, ia)[i] +
-                                   ((j == it) ? dr_dT1 * (K1.K12(iz, ia)[i] +
-                                                          K2.K12(iz, ia)[i])
+                                   ((j == it) ? dr_dT1 * (k1_k12[i] +
+                                                          k2_k12[i])
                                               : 0.0));
         dT1[j].Mat2(i).noalias() =
             T.Mat2(i) * da +
@@ -382,12 +414,12 @@ inline void dtransmat2(TransmissionMatrix& T,
       }
       if (dK2[j].NumberOfFrequencies()) {
         const Numeric da = -0.5 * (r * dK2[j].Kjj(iz, ia)[i] +
-                                   ((j == it) ? dr_dT2 * (K1.Kjj(iz, ia)[i] +
-                                                          K2.Kjj(iz, ia)[i])
+                                   ((j == it) ? dr_dT2 * (k1_kjj[i] +
+                                                          k2_kjj[i])
                                               : 0.0)),
                       db = -0.5 * (r * dK2[j].K12(iz, ia)[i] +
-                                   ((j == it) ? dr_dT2 * (K1.K12(iz, ia)[i] +
-                                                          K2.K12(iz, ia)[i])
+                                   ((j == it) ? dr_dT2 * (k1_k12[i] +
+                                                          k2_k12[i])
                                               : 0.0));
         dT2[j].Mat2(i).noalias() =
             T.Mat2(i) * da +
@@ -410,11 +442,19 @@ inline void dtransmat3(TransmissionMatrix& T,
                        const Index it,
                        const Index iz,
                        const Index ia) noexcept {
+  const ConstVectorView k1_kjj = K1.Kjj(iz, ia),
+                        k1_k12 = K1.K12(iz, ia),
+                        k1_k13 = K1.K13(iz, ia),
+                        k1_k23 = K1.K23(iz, ia);
+  const ConstVectorView k2_kjj = K2.Kjj(iz, ia),
+                        k2_k12 = K2.K12(iz, ia),
+                        k2_k13 = K2.K13(iz, ia),
+                        k2_k23 = K2.K23(iz, ia);
   for (Index i = 0; i < K1.NumberOfFrequencies(); i++) {
-    const Numeric a = -0.5 * r * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i]),
-                  b = -0.5 * r * (K1.K12(iz, ia)[i] + K2.K12(iz, ia)[i]),
-                  c = -0.5 * r * (K1.K13(iz, ia)[i] + K2.K13(iz, ia)[i]),
-                  u = -0.5 * r * (K1.K23(iz, ia)[i] + K2.K23(iz, ia)[i]);
+    const Numeric a = -0.5 * r * (k1_kjj[i] + k2_kjj[i]),
+                  b = -0.5 * r * (k1_k12[i] + k2_k12[i]),
+                  c = -0.5 * r * (k1_k13[i] + k2_k13[i]),
+                  u = -0.5 * r * (k1_k23[i] + k2_k23[i]);
     const Numeric exp_a = std::exp(a);
 
     if (b == 0. and c == 0. and u == 0.) {
@@ -425,14 +465,14 @@ inline void dtransmat3(TransmissionMatrix& T,
               T.Mat3(i) *
               (-0.5 *
                (r * dK1[j].Kjj(iz, ia)[i] +
-                ((j == it) ? dr_dT1 * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i])
+                ((j == it) ? dr_dT1 * (k1_kjj[i] + k2_kjj[i])
                            : 0.0)));
         if (dK2[j].NumberOfFrequencies())
           dT2[j].Mat3(i).noalias() =
               T.Mat3(i) *
               (-0.5 *
                (r * dK2[j].Kjj(iz, ia)[i] +
-                ((j == it) ? dr_dT2 * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i])
+                ((j == it) ? dr_dT2 * (k1_kjj[i] + k2_kjj[i])
                            : 0.0)));
       }
     } else {
@@ -484,20 +524,20 @@ inline void dtransmat3(TransmissionMatrix& T,
       for (Index j = 0; j < dT1.nelem(); j++) {
         if (dK1[j].NumberOfFrequencies()) {
           const Numeric da = -0.5 * (r * dK1[j].Kjj(iz, ia)[i] +
-                                     ((j == it) ? dr_dT1 * (K1.Kjj(iz, ia)[i] +
-                                                            K2.Kjj(iz, ia)[i])
+                                     ((j == it) ? dr_dT1 * (k1_kjj[i] +
+                                                            k2_kjj[i])
                                                 : 0.0)),
                         db = -0.5 * (r * dK1[j].K12(iz, ia)[i] +
-                                     ((j == it) ? dr_dT1 * (K1.K12(iz, ia)[i] +
-                                                            K2.K12(iz, ia)[i])
+                                     ((j == it) ? dr_dT1 * (k1_k12[i] +
+                                                            k2_k12[i])
                                                 : 0.0)),
                         dc = -0.5 * (r * dK1[j].K13(iz, ia)[i] +
-                                     ((j == it) ? dr_dT1 * (K1.K13(iz, ia)[i] +
-                                                            K2.K13(iz, ia)[i])
+                                     ((j == it) ? dr_dT1 * (k1_k13[i] +
+                                                            k2_k13[i])
                                                 : 0.0)),
                         du = -0.5 * (r * dK1[j].K23(iz, ia)[i] +
-                                     ((j == it) ? dr_dT1 * (K1.K23(iz, ia)[i] +
-                                                            K2.K23(iz, ia)[i])
+                                     ((j == it) ? dr_dT1 * (k1_k23[i] +
+                                                            k2_k23[i])
                                                 : 0.0));
           const Numeric da2 = 2 * a * da, db2 = 2 * b * db, dc2 = 2 * c * dc,
                         du2 = 2 * u * du;
@@ -541,20 +581,20 @@ inline void dtransmat3(TransmissionMatrix& T,
         }
         if (dK2[j].NumberOfFrequencies()) {
           const Numeric da = -0.5 * (r * dK2[j].Kjj(iz, ia)[i] +
-                                     ((j == it) ? dr_dT2 * (K1.Kjj(iz, ia)[i] +
-                                                            K2.Kjj(iz, ia)[i])
+                                     ((j == it) ? dr_dT2 * (k1_kjj[i] +
+                                                            k2_kjj[i])
                                                 : 0.0)),
                         db = -0.5 * (r * dK2[j].K12(iz, ia)[i] +
-                                     ((j == it) ? dr_dT2 * (K1.K12(iz, ia)[i] +
-                                                            K2.K12(iz, ia)[i])
+                                     ((j == it) ? dr_dT2 * (k1_k12[i] +
+                                                            k2_k12[i])
                                                 : 0.0)),
                         dc = -0.5 * (r * dK2[j].K13(iz, ia)[i] +
-                                     ((j == it) ? dr_dT2 * (K1.K13(iz, ia)[i] +
-                                                            K2.K13(iz, ia)[i])
+                                     ((j == it) ? dr_dT2 * (k1_k13[i] +
+                                                            k2_k13[i])
                                                 : 0.0)),
                         du = -0.5 * (r * dK2[j].K23(iz, ia)[i] +
-                                     ((j == it) ? dr_dT2 * (K1.K23(iz, ia)[i] +
-                                                            K2.K23(iz, ia)[i])
+                                     ((j == it) ? dr_dT2 * (k1_k23[i] +
+                                                            k2_k23[i])
                                                 : 0.0));
           const Numeric da2 = 2 * a * da, db2 = 2 * b * db, dc2 = 2 * c * dc,
                         du2 = 2 * u * du;
@@ -614,15 +654,29 @@ inline void dtransmat4(TransmissionMatrix& T,
                        const Index it,
                        const Index iz,
                        const Index ia) noexcept {
+  const ConstVectorView k1_kjj = K1.Kjj(iz, ia),
+                        k1_k12 = K1.K12(iz, ia),
+                        k1_k13 = K1.K13(iz, ia),
+                        k1_k14 = K1.K14(iz, ia),
+                        k1_k23 = K1.K23(iz, ia),
+                        k1_k24 = K1.K24(iz, ia),
+                        k1_k34 = K1.K34(iz, ia);
+  const ConstVectorView k2_kjj = K2.Kjj(iz, ia),
+                        k2_k12 = K2.K12(iz, ia),
+                        k2_k13 = K2.K13(iz, ia),
+                        k2_k14 = K2.K14(iz, ia),
+                        k2_k23 = K2.K23(iz, ia),
+                        k2_k24 = K2.K24(iz, ia),
+                        k2_k34 = K2.K34(iz, ia);
   static constexpr Numeric sqrt_05 = Constant::inv_sqrt_2;
   for (Index i = 0; i < K1.NumberOfFrequencies(); i++) {
-    const Numeric a = -0.5 * r * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i]),
-                  b = -0.5 * r * (K1.K12(iz, ia)[i] + K2.K12(iz, ia)[i]),
-                  c = -0.5 * r * (K1.K13(iz, ia)[i] + K2.K13(iz, ia)[i]),
-                  d = -0.5 * r * (K1.K14(iz, ia)[i] + K2.K14(iz, ia)[i]),
-                  u = -0.5 * r * (K1.K23(iz, ia)[i] + K2.K23(iz, ia)[i]),
-                  v = -0.5 * r * (K1.K24(iz, ia)[i] + K2.K24(iz, ia)[i]),
-                  w = -0.5 * r * (K1.K34(iz, ia)[i] + K2.K34(iz, ia)[i]);
+    const Numeric a = -0.5 * r * (k1_kjj[i] + k2_kjj[i]),
+                  b = -0.5 * r * (k1_k12[i] + k2_k12[i]),
+                  c = -0.5 * r * (k1_k13[i] + k2_k13[i]),
+                  d = -0.5 * r * (k1_k14[i] + k2_k14[i]),
+                  u = -0.5 * r * (k1_k23[i] + k2_k23[i]),
+                  v = -0.5 * r * (k1_k24[i] + k2_k24[i]),
+                  w = -0.5 * r * (k1_k34[i] + k2_k34[i]);
     const Numeric exp_a = std::exp(a);
 
     if (b == 0. and c == 0. and d == 0. and u == 0. and v == 0. and w == 0.) {
@@ -633,14 +687,14 @@ inline void dtransmat4(TransmissionMatrix& T,
               T.Mat4(i) *
               (-0.5 *
                (r * dK1[j].Kjj(iz, ia)[i] +
-                ((j == it) ? dr_dT1 * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i])
+                ((j == it) ? dr_dT1 * (k1_kjj[i] + k2_kjj[i])
                            : 0.0)));
         if (dK2[j].NumberOfFrequencies())
           dT2[j].Mat4(i).noalias() =
               T.Mat4(i) *
               (-0.5 *
                (r * dK2[j].Kjj(iz, ia)[i] +
-                ((j == it) ? dr_dT2 * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i])
+                ((j == it) ? dr_dT2 * (k1_kjj[i] + k2_kjj[i])
                            : 0.0)));
       }
     } else {
@@ -748,32 +802,32 @@ inline void dtransmat4(TransmissionMatrix& T,
       for (Index j = 0; j < dK1.nelem(); j++) {
         if (dK1[j].NumberOfFrequencies()) {
           const Numeric da = -0.5 * (r * dK1[j].Kjj(iz, ia)[i] +
-                                     ((j == it) ? dr_dT1 * (K1.Kjj(iz, ia)[i] +
-                                                            K2.Kjj(iz, ia)[i])
+                                     ((j == it) ? dr_dT1 * (k1_kjj[i] +
+                                                            k2_kjj[i])
                                                 : 0.0)),
                         db = -0.5 * (r * dK1[j].K12(iz, ia)[i] +
-                                     ((j == it) ? dr_dT1 * (K1.K12(iz, ia)[i] +
-                                                            K2.K12(iz, ia)[i])
+                                     ((j == it) ? dr_dT1 * (k1_k12[i] +
+                                                            k2_k12[i])
                                                 : 0.0)),
                         dc = -0.5 * (r * dK1[j].K13(iz, ia)[i] +
-                                     ((j == it) ? dr_dT1 * (K1.K13(iz, ia)[i] +
-                                                            K2.K13(iz, ia)[i])
+                                     ((j == it) ? dr_dT1 * (k1_k13[i] +
+                                                            k2_k13[i])
                                                 : 0.0)),
                         dd = -0.5 * (r * dK1[j].K14(iz, ia)[i] +
-                                     ((j == it) ? dr_dT1 * (K1.K14(iz, ia)[i] +
-                                                            K2.K14(iz, ia)[i])
+                                     ((j == it) ? dr_dT1 * (k1_k14[i] +
+                                                            k2_k14[i])
                                                 : 0.0)),
                         du = -0.5 * (r * dK1[j].K23(iz, ia)[i] +
-                                     ((j == it) ? dr_dT1 * (K1.K23(iz, ia)[i] +
-                                                            K2.K23(iz, ia)[i])
+                                     ((j == it) ? dr_dT1 * (k1_k23[i] +
+                                                            k2_k23[i])
                                                 : 0.0)),
                         dv = -0.5 * (r * dK1[j].K24(iz, ia)[i] +
-                                     ((j == it) ? dr_dT1 * (K1.K24(iz, ia)[i] +
-                                                            K2.K24(iz, ia)[i])
+                                     ((j == it) ? dr_dT1 * (k1_k24[i] +
+                                                            k2_k24[i])
                                                 : 0.0)),
                         dw = -0.5 * (r * dK1[j].K34(iz, ia)[i] +
-                                     ((j == it) ? dr_dT1 * (K1.K34(iz, ia)[i] +
-                                                            K2.K34(iz, ia)[i])
+                                     ((j == it) ? dr_dT1 * (k1_k34[i] +
+                                                            k2_k34[i])
                                                 : 0.0));
           const Numeric db2 = 2 * db * b, dc2 = 2 * dc * c, dd2 = 2 * dd * d,
                         du2 = 2 * du * u, dv2 = 2 * dv * v, dw2 = 2 * dw * w;
@@ -950,32 +1004,32 @@ inline void dtransmat4(TransmissionMatrix& T,
         }
         if (dK2[j].NumberOfFrequencies()) {
           const Numeric da = -0.5 * (r * dK2[j].Kjj(iz, ia)[i] +
-                                     ((j == it) ? dr_dT2 * (K1.Kjj(iz, ia)[i] +
-                                                            K2.Kjj(iz, ia)[i])
+                                     ((j == it) ? dr_dT2 * (k1_kjj[i] +
+                                                            k2_kjj[i])
                                                 : 0.0)),
                         db = -0.5 * (r * dK2[j].K12(iz, ia)[i] +
-                                     ((j == it) ? dr_dT2 * (K1.K12(iz, ia)[i] +
-                                                            K2.K12(iz, ia)[i])
+                                     ((j == it) ? dr_dT2 * (k1_k12[i] +
+                                                            k2_k12[i])
                                                 : 0.0)),
                         dc = -0.5 * (r * dK2[j].K13(iz, ia)[i] +
-                                     ((j == it) ? dr_dT2 * (K1.K13(iz, ia)[i] +
-                                                            K2.K13(iz, ia)[i])
+                                     ((j == it) ? dr_dT2 * (k1_k13[i] +
+                                                            k2_k13[i])
                                                 : 0.0)),
                         dd = -0.5 * (r * dK2[j].K14(iz, ia)[i] +
-                                     ((j == it) ? dr_dT2 * (K1.K14(iz, ia)[i] +
-                                                            K2.K14(iz, ia)[i])
+                                     ((j == it) ? dr_dT2 * (k1_k14[i] +
+                                                            k2_k14[i])
                                                 : 0.0)),
                         du = -0.5 * (r * dK2[j].K23(iz, ia)[i] +
-                                     ((j == it) ? dr_dT2 * (K1.K23(iz, ia)[i] +
-                                                            K2.K23(iz, ia)[i])
+                                     ((j == it) ? dr_dT2 * (k1_k23[i] +
+                                                            k2_k23[i])
                                                 : 0.0)),
                         dv = -0.5 * (r * dK2[j].K24(iz, ia)[i] +
-                                     ((j == it) ? dr_dT2 * (K1.K24(iz, ia)[i] +
-                                                            K2.K24(iz, ia)[i])
+                                     ((j == it) ? dr_dT2 * (k1_k24[i] +
+                                                            k2_k24[i])
                                                 : 0.0)),
                         dw = -0.5 * (r * dK2[j].K34(iz, ia)[i] +
-                                     ((j == it) ? dr_dT2 * (K1.K34(iz, ia)[i] +
-                                                            K2.K34(iz, ia)[i])
+                                     ((j == it) ? dr_dT2 * (k1_k34[i] +
+                                                            k2_k34[i])
                                                 : 0.0));
           const Numeric db2 = 2 * db * b, dc2 = 2 * dc * c, dd2 = 2 * dd * d,
                         du2 = 2 * du * u, dv2 = 2 * dv * v, dw2 = 2 * dw * w;
@@ -1222,18 +1276,42 @@ void stepwise_transmission(TransmissionMatrix& T,
         T, dT1, dT2, K1, K2, dK1, dK2, r, dr_dtemp1, dr_dtemp2, temp_deriv_pos);
 }
 
-void stepwise_source(RadiationVector& J,
-                     ArrayOfRadiationVector& dJ,
-                     const PropagationMatrix& K,
-                     const StokesVector& a,
-                     const StokesVector& S,
-                     const ArrayOfPropagationMatrix& dK,
-                     const ArrayOfStokesVector& da,
-                     const ArrayOfStokesVector& dS,
-                     const ConstVectorView B,
-                     const ConstVectorView dB_dT,
-                     const ArrayOfRetrievalQuantity& jacobian_quantities,
-                     const bool& jacobian_do) {
+/** The stepwise source for a Stokes dimension known at compile time
+ *
+ * See stepwise_source for the parameters
+ */
+template <int N>
+void stepwise_source_impl(RadiationVector& J,
+                          ArrayOfRadiationVector& dJ,
+                          const PropagationMatrix& K,
+                          const StokesVector& a,
+                          const StokesVector& S,
+                          const ArrayOfPropagationMatrix& dK,
+                          const ArrayOfStokesVector& da,
+                          const ArrayOfStokesVector& dS,
+                          const ConstVectorView B,
+                          const ConstVectorView dB_dT,
+                          const ArrayOfRetrievalQuantity& jacobian_quantities,
+                          const bool& jacobian_do) {
+  // Scalar radiative transfer without derivatives: J = (a B + S) / K, or
+  // zero where K is zero, as one branch-free pass over the frequencies
+  if constexpr (N == 1) {
+    if (not jacobian_do) {
+      const Index nf = K.NumberOfFrequencies();
+      const ConstVectorView K_jj = K.Kjj(), a_jj = a.Kjj();
+      if (S.IsEmpty()) {
+        for (Index i = 0; i < nf; i++)
+          J.Vec1(i)[0] = K_jj[i] == 0 ? 0 : a_jj[i] * B[i] * (1 / K_jj[i]);
+      } else {
+        const ConstVectorView S_jj = S.Kjj();
+        for (Index i = 0; i < nf; i++)
+          J.Vec1(i)[0] =
+              K_jj[i] == 0 ? 0 : (a_jj[i] * B[i] + S_jj[i]) * (1 / K_jj[i]);
+      }
+      return;
+    }
+  }
+
   for (Index i = 0; i < K.NumberOfFrequencies(); i++) {
     if (K.IsRotational(i)) {
       J.SetZero(i);
@@ -1244,98 +1322,125 @@ void stepwise_source(RadiationVector& J,
       }
     } else {
       J.setSource(a, B, S, i);
-      switch (J.StokesDim()) {
-        case 4: {
-          const auto invK = inv4(K.Kjj()[i],
-                                 K.K12()[i],
-                                 K.K13()[i],
-                                 K.K14()[i],
-                                 K.K23()[i],
-                                 K.K24()[i],
-                                 K.K34()[i]);
-          J.Vec4(i) = invK * J.Vec4(i);
-          if (jacobian_do)
-            for (Index j = 0; j < jacobian_quantities.nelem(); j++)
-              if (dJ[j].Frequencies() == da[j].NumberOfFrequencies() and dJ[j].Frequencies() == dS[j].NumberOfFrequencies())
-                dJ[j].Vec4(i).noalias() =
-                    0.5 * invK *
-                    (vector4(a,
-                             B,
-                             da[j],
-                             dB_dT,
-                             dS[j],
-                             jacobian_quantities[j] == Jacobian::Atm::Temperature,
-                             i) -
-                     matrix4(dK[j].Kjj()[i],
-                             dK[j].K12()[i],
-                             dK[j].K13()[i],
-                             dK[j].K14()[i],
-                             dK[j].K23()[i],
-                             dK[j].K24()[i],
-                             dK[j].K34()[i]) *
-                         J.Vec4(i));
-        } break;
-        case 3: {
-          const auto invK =
-              inv3(K.Kjj()[i], K.K12()[i], K.K13()[i], K.K23()[i]);
-          J.Vec3(i) = invK * J.Vec3(i);
-          if (jacobian_do)
-            for (Index j = 0; j < jacobian_quantities.nelem(); j++)
-              if (dJ[j].Frequencies() == da[j].NumberOfFrequencies() and dJ[j].Frequencies() == dS[j].NumberOfFrequencies())
-                dJ[j].Vec3(i).noalias() =
-                    0.5 * invK *
-                    (vector3(a,
-                             B,
-                             da[j],
-                             dB_dT,
-                             dS[j],
-                             jacobian_quantities[j] == Jacobian::Atm::Temperature,
-                             i) -
-                     matrix3(dK[j].Kjj()[i],
-                             dK[j].K12()[i],
-                             dK[j].K13()[i],
-                             dK[j].K23()[i]) *
-                         J.Vec3(i));
-        } break;
-        case 2: {
-          const auto invK = inv2(K.Kjj()[i], K.K12()[i]);
-          J.Vec2(i) = invK * J.Vec2(i);
-          if (jacobian_do)
-            for (Index j = 0; j < jacobian_quantities.nelem(); j++)
-              if (dJ[j].Frequencies() == da[j].NumberOfFrequencies() and dJ[j].Frequencies() == dS[j].NumberOfFrequencies())
-                dJ[j].Vec2(i).noalias() =
-                    0.5 * invK *
-                    (vector2(a,
-                             B,
-                             da[j],
-                             dB_dT,
-                             dS[j],
-                             jacobian_quantities[j] == Jacobian::Atm::Temperature,
-                             i) -
-                     matrix2(dK[j].Kjj()[i], dK[j].K12()[i]) * J.Vec2(i));
-        } break;
-        default: {
-          const auto invK = 1 / K.Kjj()[i];
-          J.Vec1(i)[0] *= invK;
-          if (jacobian_do)
-            for (Index j = 0; j < jacobian_quantities.nelem(); j++)
-              if (dJ[j].Frequencies() == da[j].NumberOfFrequencies() and dJ[j].Frequencies() == dS[j].NumberOfFrequencies())
-                dJ[j].Vec1(i)[0] =
-                    0.5 * invK *
-                    (vector1(a,
-                             B,
-                             da[j],
-                             dB_dT,
-                             dS[j],
-                             jacobian_quantities[j] == Jacobian::Atm::Temperature,
-                             i) -
-                     dK[j].Kjj()[i] * J.Vec1(i)[0]);
-        } break;
+      if constexpr (N == 4) {
+        const auto invK = inv4(K.Kjj()[i],
+                               K.K12()[i],
+                               K.K13()[i],
+                               K.K14()[i],
+                               K.K23()[i],
+                               K.K24()[i],
+                               K.K34()[i]);
+        J.Vec4(i) = invK * J.Vec4(i);
+        if (jacobian_do)
+          for (Index j = 0; j < jacobian_quantities.nelem(); j++)
+            if (dJ[j].Frequencies() == da[j].NumberOfFrequencies() and dJ[j].Frequencies() == dS[j].NumberOfFrequencies())
+              dJ[j].Vec4(i).noalias() =
+                  0.5 * invK *
+                  (vector4(a,
+                           B,
+                           da[j],
+                           dB_dT,
+                           dS[j],
+                           jacobian_quantities[j] == Jacobian::Atm::Temperature,
+                           i) -
+                   matrix4(dK[j].Kjj()[i],
+                           dK[j].K12()[i],
+                           dK[j].K13()[i],
+                           dK[j].K14()[i],
+                           dK[j].K23()[i],
+                           dK[j].K24()[i],
+                           dK[j].K34()[i]) *
+                       J.Vec4(i));
+      } else if constexpr (N == 3) {
+        const auto invK =
+            inv3(K.Kjj()[i], K.K12()[i], K.K13()[i], K.K23()[i]);
+        J.Vec3(i) = invK * J.Vec3(i);
+        if (jacobian_do)
+          for (Index j = 0; j < jacobian_quantities.nelem(); j++)
+            if (dJ[j].Frequencies() == da[j].NumberOfFrequencies() and dJ[j].Frequencies() == dS[j].NumberOfFrequencies())
+              dJ[j].Vec3(i).noalias() =
+                  0.5 * invK *
+                  (vector3(a,
+                           B,
+                           da[j],
+                           dB_dT,
+                           dS[j],
+                           jacobian_quantities[j] == Jacobian::Atm::Temperature,
+                           i) -
+                   matrix3(dK[j].Kjj()[i],
+                           dK[j].K12()[i],
+                           dK[j].K13()[i],
+                           dK[j].K23()[i]) *
+                       J.Vec3(i));
+      } else if constexpr (N == 2) {
+        const auto invK = inv2(K.Kjj()[i], K.K12()[i]);
+        J.Vec2(i) = invK * J.Vec2(i);
+        if (jacobian_do)
+          for (Index j = 0; j < jacobian_quantities.nelem(); j++)
+            if (dJ[j].Frequencies() == da[j].NumberOfFrequencies() and dJ[j].Frequencies() == dS[j].NumberOfFrequencies())
+              dJ[j].Vec2(i).noalias() =
+                  0.5 * invK *
+                  (vector2(a,
+                           B,
+                           da[j],
+                           dB_dT,
+                           dS[j],
+                           jacobian_quantities[j] == Jacobian::Atm::Temperature,
+                           i) -
+                   matrix2(dK[j].Kjj()[i], dK[j].K12()[i]) * J.Vec2(i));
+      } else {
+        const auto invK = 1 / K.Kjj()[i];
+        J.Vec1(i)[0] *= invK;
+        if (jacobian_do)
+          for (Index j = 0; j < jacobian_quantities.nelem(); j++)
+            if (dJ[j].Frequencies() == da[j].NumberOfFrequencies() and dJ[j].Frequencies() == dS[j].NumberOfFrequencies())
+              dJ[j].Vec1(i)[0] =
+                  0.5 * invK *
+                  (vector1(a,
+                           B,
+                           da[j],
+                           dB_dT,
+                           dS[j],
+                           jacobian_quantities[j] == Jacobian::Atm::Temperature,
+                           i) -
+                   dK[j].Kjj()[i] * J.Vec1(i)[0]);
       }
     }
   }
 }
 
+void stepwise_source(RadiationVector& J,
+                     ArrayOfRadiationVector& dJ,
+                     const PropagationMatrix& K,
+                     const StokesVector& a,
+                     const StokesVector& S,
+                     const ArrayOfPropagationMatrix& dK,
+                     const ArrayOfStokesVector& da,
+                     const ArrayOfStokesVector& dS,
+                     const ConstVectorView B,
+                     const ConstVectorView dB_dT,
+                     const ArrayOfRetrievalQuantity& jacobian_quantities,
+                     const bool& jacobian_do) {
+  switch (J.StokesDim()) {
+    case 4:
+      stepwise_source_impl<4>(
+          J, dJ, K, a, S, dK, da, dS, B, dB_dT, jacobian_quantities, jacobian_do);
+      break;
+    case 3:
+      stepwise_source_impl<3>(
+          J, dJ, K, a, S, dK, da, dS, B, dB_dT, jacobian_quantities, jacobian_do);
+      break;
+    case 2:
+      stepwise_source_impl<2>(
+          J, dJ, K, a, S, dK, da, dS, B, dB_dT, jacobian_quantities, jacobian_do);
+      break;
+    default:
+      stepwise_source_impl<1>(
+          J, dJ, K, a, S, dK, da, dS, B, dB_dT, jacobian_quantities, jacobian_do);
+      break;
+  }
+}
+
 void update_radiation_vector(RadiationVector& I,
                              ArrayOfRadiationVector& dI1,
                              ArrayOfRadiationVector& dI2,
@@ -1359,6 +1464,11 @@ void update_radiation_vector(RadiationVector& I,
                              const RadiativeTransferSolver solver) {
   switch (solver) {
     case RadiativeTransferSolver::Emission: {
+      if (dI1.empty()) {
+        I.leftMulAroundAvg(T, J1, J2);
+        break;
+      }
+
       I.rem_avg(J1, J2);
       for (size_t i = 0; i < dI1.size(); i++) {
         dI1[i].addDerivEmission(PiT, dT1[i], T, I, dJ1[i]);
@@ -664,6 +664,36 @@ class RadiationVector {
       R1[i].noalias() += 0.5 * (O1.R1[i] + O2.R1[i]);
   }
   
+  /** Set *this to T (*this - avg) + avg, where avg is the average of O1 and O2
+   *
+   * Same as rem_avg(O1, O2), leftMul(T), and add_avg(O1, O2) in turn, but in
+   * one pass over the frequencies
+   *
+   * @param[in] T Transmission matrix
+   * @param[in] O1 Input 1
+   * @param[in] O2 Input 2
+   */
+  void leftMulAroundAvg(const TransmissionMatrix& T,
+                        const RadiationVector& O1,
+                        const RadiationVector& O2) {
+    for (size_t i = 0; i < R4.size(); i++) {
+      const Eigen::Vector4d avg = 0.5 * (O1.R4[i] + O2.R4[i]);
+      R4[i] = T.Mat4(i) * (R4[i] - avg) + avg;
+    }
+    for (size_t i = 0; i < R3.size(); i++) {
+      const Eigen::Vector3d avg = 0.5 * (O1.R3[i] + O2.R3[i]);
+      R3[i] = T.Mat3(i) * (R3[i] - avg) + avg;
+    }
+    for (size_t i = 0; i < R2.size(); i++) {
+      const Eigen::Vector2d avg = 0.5 * (O1.R2[i] + O2.R2[i]);
+      R2[i] = T.Mat2(i) * (R2[i] - avg) + avg;
+    }
+    for (size_t i = 0; i < R1.size(); i++) {
+      const Numeric avg = 0.5 * (O1.R1[i][0] + O2.R1[i][0]);
+      R1[i][0] = T.Mat1(i)(0, 0) * (R1[i][0] - avg) + avg;
+    }
+  }
+
   /** Add the weighted source of two RadiationVector to *this
    * 
    * @param[in] T The transmission matrix
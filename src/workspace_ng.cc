@@ -45,6 +45,30 @@ Workspace::Workspace()
 {
 }
 
+Workspace::WsvStruct *Workspace::new_wsv_struct() {
+  if (wsv_struct_free.empty()) {
+    constexpr Index block_size = 64;
+    wsv_struct_blocks.emplace_back(new WsvStruct[block_size]);
+    for (Index j = block_size - 1; j >= 0; j--)
+      wsv_struct_free.push_back(&wsv_struct_blocks.back()[j]);
+  }
+  WsvStruct *wsvs = wsv_struct_free.back();
+  wsv_struct_free.pop_back();
+  wsvs->shared = false;
+  return wsvs;
+}
+
+const Workspace::WsvStruct *Workspace::top(Index i) const {
+  if (ws_fork && ws.empty()) return &(*ws_fork)[i];
+  if (i < (Index)ws_forked.size() && ws_forked[i]) return &(*ws_fork)[i];
+  return ws[i].size() ? ws[i].top() : NULL;
+}
+
+void Workspace::allocate_stacks() {
+  ws.resize(ws_fork->size());
+  ws_forked.assign(ws_fork->size(), true);
+}
+
 void Workspace::define_wsv_map() {
   for (Index i = 0; i < wsv_data.nelem(); ++i) {
     WsvMap[wsv_data[i].Name()] = i;
@@ -59,23 +83,28 @@ Index Workspace::add_wsv(const WsvRecord &wsv) {
 
 Index Workspace::add_wsv_inplace(const WsvRecord &wsv) {
   const Index pos = add_wsv(wsv);
-  ws.push_back(stack<WsvStruct *>());
+  if (ws_fork && ws.empty()) allocate_stacks();
+  ws.push_back(WsvStack());
   return pos;
 }
 
 void Workspace::del(Index i) {
+  materialize(i);
   WsvStruct *wsvs = ws[i].top();
 
   if (wsvs && wsvs->wsv) {
-    workspace_memory_handler.deallocate(wsv_data[i].Group(), wsvs->wsv);
+    if (!wsvs->shared)
+      workspace_memory_handler.deallocate(wsv_data[i].Group(), wsvs->wsv);
     wsvs->wsv = NULL;
     wsvs->auto_allocated = false;
     wsvs->initialized = false;
+    wsvs->shared = false;
   }
 }
 
 void Workspace::duplicate(Index i) {
-  WsvStruct *wsvs = new WsvStruct;
+  materialize(i);
+  WsvStruct *wsvs = new_wsv_struct();
 
   wsvs->auto_allocated = true;
   if (ws[i].size() && ws[i].top()->wsv) {
@@ -89,22 +118,32 @@ void Workspace::duplicate(Index i) {
   ws[i].push(wsvs);
 }
 
-Workspace::Workspace(const Workspace &workspace) : ws(workspace.ws.nelem()) {
+Workspace::Workspace(const Workspace &workspace) : ws(0) {
 #ifndef NDEBUG
   context = workspace.context;
 #endif
+  // An untouched copy still looks exactly like its snapshot
+  if (workspace.ws_fork && workspace.ws.empty()) {
+    ws_fork = workspace.ws_fork;
+    return;
+  }
+
+  std::vector<WsvStruct> fork(workspace.ws.nelem());
   for (Index i = 0; i < workspace.ws.nelem(); i++) {
-    WsvStruct *wsvs = new WsvStruct;
-    wsvs->auto_allocated = false;
-    if (workspace.ws[i].size() && workspace.ws[i].top()->wsv) {
-      wsvs->wsv = workspace.ws[i].top()->wsv;
-      wsvs->initialized = workspace.ws[i].top()->initialized;
+    const WsvStruct *orig = workspace.top(i);
+    WsvStruct &wsvs = fork[i];
+    wsvs.auto_allocated = false;
+    if (orig && orig->wsv) {
+      wsvs.wsv = orig->wsv;
+      wsvs.initialized = orig->initialized;
+      wsvs.shared = true;
     } else {
-      wsvs->wsv = NULL;
-      wsvs->initialized = false;
+      wsvs.wsv = NULL;
+      wsvs.initialized = false;
+      wsvs.shared = false;
     }
-    ws[i].push(wsvs);
   }
+  ws_fork = std::make_shared<const std::vector<WsvStruct> >(std::move(fork));
 }
 
 Workspace::~Workspace() {
@@ -120,37 +159,39 @@ Workspace::~Workspace() {
       if (wsvs->auto_allocated && wsvs->wsv) {
         workspace_memory_handler.deallocate(wsv_data[i].Group(), wsvs->wsv);
       }
-      delete (wsvs);
       ws[i].pop();
     }
   }
 }
 
 void *Workspace::pop(Index i) {
+  materialize(i);
   WsvStruct *wsvs = ws[i].top();
   void *vp = NULL;
   if (wsvs) {
     vp = wsvs->wsv;
-    delete wsvs;
+    free_wsv_struct(wsvs);
     ws[i].pop();
   }
   return vp;
 }
 
 void Workspace::pop_free(Index i) {
+  materialize(i);
   WsvStruct *wsvs = ws[i].top();
 
   if (wsvs) {
-    if (wsvs->wsv)
+    if (wsvs->wsv && !wsvs->shared)
       workspace_memory_handler.deallocate(wsv_data[i].Group(), wsvs->wsv);
 
-    delete wsvs;
+    free_wsv_struct(wsvs);
     ws[i].pop();
   }
 }
 
 void Workspace::push(Index i, void *wsv) {
-  WsvStruct *wsvs = new WsvStruct;
+  materialize(i);
+  WsvStruct *wsvs = new_wsv_struct();
   wsvs->auto_allocated = false;
   wsvs->initialized = true;
   wsvs->wsv = wsv;
@@ -158,7 +199,8 @@ void Workspace::push(Index i, void *wsv) {
 }
 
 void Workspace::push_uninitialized(Index i, void *wsv) {
-  WsvStruct *wsvs = new WsvStruct;
+  materialize(i);
+  WsvStruct *wsvs = new_wsv_struct();
   wsvs->auto_allocated = false;
   wsvs->initialized = false;
   wsvs->wsv = wsv;
@@ -166,6 +208,7 @@ void Workspace::push_uninitialized(Index i, void *wsv) {
 }
 
 void *Workspace::operator[](Index i) {
+  materialize(i);
   if (!ws[i].size()) push(i, NULL);
 
   if (!ws[i].top()->wsv) {
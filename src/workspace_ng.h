@@ -26,7 +26,9 @@
 #define WORKSPACE_NG_INCLUDED
 
 #include <map>
+#include <memory>
 #include <stack>
+#include <vector>
 
 class Workspace;
 
@@ -43,10 +45,64 @@ class Workspace {
     void *wsv;
     bool initialized;
     bool auto_allocated;
+    /** The value belongs to another workspace and must not be freed. */
+    bool shared;
   };
 
+  /** Stack of one WSV. Backed by a vector so that empty stacks are free. */
+  using WsvStack = stack<WsvStruct *, std::vector<WsvStruct *> >;
+
   /** Workspace variable container. */
-  Array<stack<WsvStruct *> > ws;
+  Array<WsvStack> ws;
+
+  /** Get a WsvStruct from the pool of this workspace. */
+  WsvStruct *new_wsv_struct();
+
+  /** Return a WsvStruct to the pool of this workspace. */
+  void free_wsv_struct(WsvStruct *wsvs) { wsv_struct_free.push_back(wsvs); }
+
+  /** Push the forked value of WSV i onto its stack if not done yet.
+   *
+   * A copied workspace does not build its stacks up front. It only refers
+   * to a snapshot of the topmost layer of the original workspace. The
+   * stacks are allocated the first time any WSV is touched, and a WSV's
+   * stack gets its forked value the first time the WSV itself is touched.
+   *
+   * @param[in] i WSV index.
+   */
+  void materialize(Index i) {
+    if (!ws_fork) return;
+    if (ws.empty()) allocate_stacks();
+    if (i < (Index)ws_forked.size() && ws_forked[i]) {
+      ws_forked[i] = false;
+      WsvStruct *wsvs = new_wsv_struct();
+      *wsvs = (*ws_fork)[i];
+      ws[i].push(wsvs);
+    }
+  }
+
+ private:
+  /** Snapshot of the topmost WSV layer of the workspace this was copied from.
+   *
+   * The snapshot is never changed. Copies of a workspace that has not been
+   * touched since it was copied share the snapshot of that workspace.
+   */
+  std::shared_ptr<const std::vector<WsvStruct> > ws_fork;
+
+  /** True for WSVs that still live only in ws_fork. */
+  std::vector<bool> ws_forked;
+
+  /** Allocate the stacks of a copied workspace. */
+  void allocate_stacks();
+
+  /** Blocks of WsvStructs owned by this workspace. */
+  std::vector<std::unique_ptr<WsvStruct[]> > wsv_struct_blocks;
+
+  /** WsvStructs ready for reuse. */
+  std::vector<WsvStruct *> wsv_struct_free;
+
+  /** The topmost WsvStruct of WSV i, or NULL if its stack is empty. */
+  const WsvStruct *top(Index i) const;
 
  public:
 #ifndef NDEBUG
@@ -69,7 +125,11 @@ class Workspace {
   /** Workspace copy constructor.
    *
    * Make a copy of a workspace. The copy constructor will only copy the topmost
-   * layer of the workspace variable stacks.
+   * layer of the workspace variable stacks. The copy shares the variables of
+   * the original, but deleting or popping them in the copy does not free
+   * them. Its stacks are only allocated when the copy is used, and copies of
+   * an untouched copy share its snapshot, so that copying a workspace for
+   * every thread of a parallel region does not scale with the number of WSVs.
    *
    * @param[in] workspace The workspace to be copied
    */
@@ -89,7 +149,9 @@ class Workspace {
 
   /** Delete WSV.
    *
-   * Frees the memory of the topmost WSV on the stack.
+   * Frees the memory of the topmost WSV on the stack. A value shared from
+   * another workspace, or with the workspace this was copied from, is only
+   * dropped.
    *
    * @param[in] i WSV index.
    */
@@ -108,7 +170,10 @@ class Workspace {
    *
    * Resize the workspace to match the number of WSVs in wsv_data.
    */
-  void initialize() { ws.resize(wsv_data.nelem()); }
+  void initialize() {
+    if (ws_fork && ws.empty()) allocate_stacks();
+    ws.resize(wsv_data.nelem());
+  }
 
   /** Checks existence of the given WSV.
    *
@@ -116,11 +181,15 @@ class Workspace {
    * @return true if the WSV exists, otherwise false.
    */
   bool is_initialized(Index i) {
-    return ((ws[i].size() != 0) && (ws[i].top()->initialized == true));
+    const WsvStruct *wsvs = top(i);
+    return wsvs && wsvs->initialized;
   }
 
   /** Return scoping level of the given WSV. */
-  Index depth(Index i) { return (Index)ws[i].size(); }
+  Index depth(Index i) {
+    materialize(i);
+    return (Index)ws[i].size();
+  }
 
   /** Remove the topmost WSV from its stack.
    *
@@ -133,6 +202,8 @@ class Workspace {
   void *pop(Index i);
 
   /** Remove the topmost WSV from its stack and free its memory.
+   *
+   * A value shared with another workspace is not freed.
    *
    * @see pop
    *
@@ -159,7 +230,9 @@ class Workspace {
   void push_uninitialized(Index i, void *wsv);
 
   /** Get the number of workspace variables. */
-  Index nelem() { return ws.nelem(); }
+  Index nelem() {
+    return ws_fork && ws.empty() ? (Index)ws_fork->size() : ws.nelem();
+  }
   
   /** Add a new variable to existing workspace and to the static maps */
   Index add_wsv_inplace(const WsvRecord &wsv);
@@ -371,6 +371,7 @@ void xml_read_from_stream(istream& is_xml,
   xml_read_from_stream(is_xml, gal.t_pert, pbifs, verbosity);
   xml_read_from_stream(is_xml, gal.nls_pert, pbifs, verbosity);
   xml_read_from_stream(is_xml, gal.xsec, pbifs, verbosity);
+  gal.XsecStoreReset();
 
   tag.read_from_stream(is_xml);
   tag.check_name("/GasAbsLookup");
@@ -411,8 +412,13 @@ void xml_write_to_stream(ostream& os_xml,
                       pbofs,
                       "NonlinearSpeciesVmrPerturbations",
                       verbosity);
-  xml_write_to_stream(
-      os_xml, gal.xsec, pbofs, "AbsorptionCrossSections", verbosity);
+  // Memory mapped and packed cross sections are written as doubles
+  const Tensor4 packed_xsec = gal.xsec_store ? gal.XsecUnpacked() : Tensor4();
+  xml_write_to_stream(os_xml,
+                      gal.xsec_store ? packed_xsec : gal.xsec,
+                      pbofs,
+                      "AbsorptionCrossSections",
+                      verbosity);
 
   close_tag.set_name("/GasAbsLookup");
   close_tag.write_to_stream(os_xml);
@@ -103,7 +103,8 @@ void zeeman_on_the_fly(
     const Index& manual_tag,
     const Numeric& H0,
     const Numeric& theta0,
-    const Numeric& eta0) try {
+    const Numeric& eta0,
+    const FaddeevaBlock::Accuracy faddeeva_accuracy) try {
   // Find relevant derivatives in retrieval quantities positions
   const ArrayOfIndex jacobian_quantities_positions =
       equivalent_propmattype_indexes(jacobian_quantities);
@@ -158,6 +159,10 @@ void zeeman_on_the_fly(
   // Main compute vectors
   Linefunctions::InternalData scratch(nf, nq), sum(nf, nq);
 
+  // Frequency range of the computations
+  const Numeric fmin = nf ? min(f_grid) : 0;
+  const Numeric fmax = nf ? max(f_grid) : 0;
+
   // Magnetic field internals and derivatives...
   const auto X =
       manual_tag
@@ -202,6 +207,10 @@ void zeeman_on_the_fly(
         continue;
       
       for (auto& band : abs_lines_per_species[ispecies]) {
+        // Lines that can contribute to this frequency grid
+        const ArrayOfIndex lines = band.LinesInFrequencyRange(fmin, fmax);
+        if (not lines.nelem()) continue;
+        
         // Constants for these lines
         const Numeric QT0 = single_partition_function(band.T0(),
                                                       partition_functions.getParamType(band.QuantumIdentity()),
@@ -224,6 +233,8 @@ void zeeman_on_the_fly(
           sum,
           f_grid,
           band,
+          *band.HotView(),
+          lines,
           jacobian_quantities,
           jacobian_quantities_positions,
           line_shape_vmr,
@@ -239,7 +250,8 @@ void zeeman_on_the_fly(
           QT0,
           false,
           true,
-          polar);
+          polar,
+          faddeeva_accuracy);
         
         auto pol_real = pol.attenuation();
         auto pol_imag = pol.dispersion();
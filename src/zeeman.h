@@ -25,6 +25,7 @@
  */
 
 #include "abs_species_tags.h"
+#include "faddeeva_block.h"
 #include "global_data.h"
 #include "physics_funcs.h"
 #include "quantum.h"
@@ -58,6 +59,7 @@
  * @param[in]  manual_zeeman_magnetic_field_strength Magnetic field strength
  * @param[in]  manual_zeeman_theta Magnetic field theta angle
  * @param[in]  manual_zeeman_eta Magnetic field eta angle
+ * @param[in]  faddeeva_accuracy Accuracy tier of the Faddeeva function
  */
 void zeeman_on_the_fly(
   ArrayOfPropagationMatrix& propmat_clearsky,
@@ -80,4 +82,5 @@ void zeeman_on_the_fly(
   const Index& manual_tag,
   const Numeric& H0,
   const Numeric& theta0,
-  const Numeric& eta0);
+  const Numeric& eta0,
+  const FaddeevaBlock::Accuracy faddeeva_accuracy=FaddeevaBlock::Accuracy::Exact);